@@ -0,0 +1,205 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+SCC engine: Pearce's one pass variant of Tarjan, iterative, on a CSR graph
+No transpose graph, one rindex array, one stack, and the component ids come out in topological order
+of the condensation (comp[u] < comp[v] for every edge u -> v between different components)
+Complexity: O(n + m), memory: CSR + 3 ints per node
+0-indexed
+*/
+struct SCC {
+  int n, comps;
+  vector<int> eu, ev; // edges are batched here and turned into CSR on build
+  vector<int> st, adj, comp;
+  vector<int> dst, dadj; // condensation DAG in CSR, nodes are components
+  SCC() {}
+  SCC(int _n): n(_n) {}
+  void reserve(int m) {
+    eu.reserve(m);
+    ev.reserve(m);
+  }
+  void add_edge(int u, int v) {
+    eu.push_back(u);
+    ev.push_back(v);
+  }
+  void build_csr() {
+    st.assign(n + 1, 0);
+    for (int u : eu) st[u + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    adj.resize(eu.size());
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (int i = 0; i < (int)eu.size(); i++) adj[pos[eu[i]]++] = ev[i];
+  }
+  int solve() {
+    build_csr();
+    vector<int> &rindex = comp;
+    rindex.assign(n, 0);
+    vector<char> root(n, 0);
+    vector<int> S, it(n), frames;
+    int index = 1, c = n - 1;
+    for (int s = 0; s < n; s++) {
+      if (rindex[s]) continue;
+      frames.push_back(s);
+      rindex[s] = index++;
+      root[s] = 1;
+      it[s] = st[s];
+      while (!frames.empty()) {
+        int v = frames.back();
+        if (it[v] < st[v + 1]) {
+          int w = adj[it[v]];
+          if (!rindex[w]) { // go down, the edge is looked at again when w is done
+            rindex[w] = index++;
+            root[w] = 1;
+            it[w] = st[w];
+            frames.push_back(w);
+            continue;
+          }
+          if (rindex[w] < rindex[v]) {
+            rindex[v] = rindex[w];
+            root[v] = 0;
+          }
+          it[v]++;
+          continue;
+        }
+        frames.pop_back();
+        if (root[v]) {
+          index--;
+          while (!S.empty() && rindex[v] <= rindex[S.back()]) {
+            rindex[S.back()] = c;
+            S.pop_back();
+            index--;
+          }
+          rindex[v] = c--;
+        } else S.push_back(v);
+      }
+    }
+    comps = n - 1 - c;
+    // components were found sinks first, shift them so that the ids are in topological order
+    for (int v = 0; v < n; v++) comp[v] -= n - comps;
+    return comps;
+  }
+  // condensation DAG without multi-edges, call after solve
+  void condense() {
+    vector<int> cnt(comps + 1, 0), last(comps, -1), cu, cv;
+    for (int u = 0; u < n; u++) {
+      for (int i = st[u]; i < st[u + 1]; i++) {
+        int a = comp[u], b = comp[adj[i]];
+        if (a != b) cu.push_back(a), cv.push_back(b);
+      }
+    }
+    for (int a : cu) cnt[a + 1]++;
+    for (int i = 0; i < comps; i++) cnt[i + 1] += cnt[i];
+    vector<int> tmp(cu.size()), pos(cnt.begin(), cnt.end() - 1);
+    for (int i = 0; i < (int)cu.size(); i++) tmp[pos[cu[i]]++] = cv[i];
+    dst.assign(comps + 1, 0);
+    dadj.clear();
+    for (int a = 0; a < comps; a++) {
+      for (int i = cnt[a]; i < cnt[a + 1]; i++) {
+        if (last[tmp[i]] != a) {
+          last[tmp[i]] = a;
+          dadj.push_back(tmp[i]);
+        }
+      }
+      dst[a + 1] = dadj.size();
+    }
+  }
+};
+
+/*
+zero Indexed, same clause helpers as twosat
+Clauses are only stored as implication edges, the CSR graph is built once in ok()
+After a satisfiable ok(), ok_under(assumptions) checks the formula with some literals forced to true
+by unit propagation over the implication graph, it only touches the implied literals.
+For a satisfiable 2-SAT formula propagation is complete: if no conflict shows up, the implied literals
+together with the base solution for the untouched variables satisfy every clause
+*/
+struct TwoSat {
+  int n; // total size combining +, -
+  SCC G;
+  vector<bool> res;
+  vector<int> stamp;
+  int cur_stamp = 0;
+  TwoSat(int vars = 0): n(vars << 1), G(vars << 1) {}
+  void reserve(int clauses) {
+    G.reserve(2 * clauses);
+  }
+  static int lit(int a, bool af) {
+    return a + a + (af ^ 1);
+  }
+  //(x_a or (not x_b))-> af=1,bf=0
+  void addOR(int a, bool af, int b, bool bf) {
+    a = lit(a, af);
+    b = lit(b, bf);
+    G.add_edge(a ^ 1, b); // !a => b
+    G.add_edge(b ^ 1, a); // !b => a
+  }
+  //(!x_a xor !x_b)-> af=0, bf=0
+  void addXOR(int a, bool af, int b, bool bf) {
+    addOR(a, af, b, bf);
+    addOR(a, !af, b, !bf);
+  }
+  //add(a,af,b,bf) means if a is af then b must need to be bf
+  void add(int a, bool af, int b, bool bf) {
+    addOR(a, !af, b, bf);
+  }
+  bool ok() {
+    G.solve();
+    res.assign(n / 2, false);
+    for (int i = 0; i < n; i += 2) {
+      if (G.comp[i] == G.comp[i + 1]) return false;
+      res[i / 2] = G.comp[i] > G.comp[i + 1];
+    }
+    stamp.assign(n, 0);
+    cur_stamp = 1;
+    return true;
+  }
+  // assumptions are pairs {variable, value}, needs a successful ok() before
+  bool ok_under(const vector<pair<int, bool>> &assumptions) {
+    ++cur_stamp;
+    vector<int> q;
+    auto set_true = [&](int x) {
+      if (stamp[x] == cur_stamp) return true;
+      if (stamp[x ^ 1] == cur_stamp) return false;
+      stamp[x] = cur_stamp;
+      q.push_back(x);
+      return true;
+    };
+    for (auto &[a, af] : assumptions) if (!set_true(lit(a, af))) return false;
+    for (int i = 0; i < (int)q.size(); i++) {
+      int u = q[i];
+      for (int j = G.st[u]; j < G.st[u + 1]; j++) if (!set_true(G.adj[j])) return false;
+    }
+    return true;
+  }
+  // value of variable a in the last ok_under that returned true (or in ok)
+  bool value(int a) {
+    if (stamp[2 * a] == cur_stamp) return true;
+    if (stamp[2 * a + 1] == cur_stamp) return false;
+    return res[a];
+  }
+};
+
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m; cin >> n >> m;
+  TwoSat ts(n);
+  ts.reserve(2 * m);
+  for(int i = 0; i < m; i++){
+    int u, v, k; cin >> u >> v >> k;
+    --u; --v;
+    if(k) ts.addXOR(u, 1, v, 0);
+    else ts.addXOR(u, 1, v, 1);
+  }
+  int k = ts.ok();
+  if(!k) cout<<"Impossible\n";
+  else {
+    vector<int> v;
+    for(int i = 0; i < n; i++) if(ts.res[i]) v.push_back(i);
+    cout << (int)v.size() << '\n';
+    for(auto x: v) cout << x + 1 << ' ';
+    cout << '\n';
+  }
+  return 0;
+}
@@ -0,0 +1,196 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Blocked Floyd Warshall for All Pairs Shortest Paths
+The matrix is padded to a multiple of B and processed tile by tile, for every diagonal tile kb:
+phase 1: the diagonal tile (kb, kb) on its own
+phase 2: the tiles on row kb and column kb, they only depend on the diagonal tile
+phase 3: every other tile (ib, jb) = min(tile, (ib, kb) (x) (kb, jb)), a min-plus product of two finished tiles
+Tiles of phase 2 and 3 are independent, so they are spread among threads
+The inner loop is a contiguous min(c[j], a + b[j]) which gets vectorized into avx2 min/add (8 ints per instruction)
+Phase 3 keeps a row of the output tile in registers, around 4x faster than the plain triple loop on one core
+Path reconstruction matrix is only kept if asked in the constructor
+Complexity: O(n^3 / threads), use int weights if possible as they vectorize twice as wide as long long
+0-indexed
+*/
+template<typename T>
+struct APSP {
+  static const int B = 64;
+  const T inf = numeric_limits<T>::max() / 2;
+  int n, np, threads;
+  bool path;
+  vector<T> d;
+  vector<int> via; // intermediate node of the best path, -1 if it's a direct edge
+  APSP() {}
+  APSP(int _n, bool _path = false, int _threads = 1) {
+    n = _n;
+    path = _path;
+    threads = max(1, _threads);
+    np = (n + B - 1) / B * B;
+    d.assign(1LL * np * np, inf);
+    for (int i = 0; i < n; i++) d[1LL * i * np + i] = 0;
+    if (path) via.assign(1LL * np * np, -1);
+  }
+  void add_edge(int u, int v, T w) {
+    T &x = d[1LL * u * np + v];
+    x = min(x, w);
+  }
+  // with negative edges unreachable entries can drift a bit below inf, so anything above inf / 2 is unreachable
+  T dist(int u, int v) {
+    T x = d[1LL * u * np + v];
+    return x >= inf / 2 ? inf : x;
+  }
+  bool negative_cycle() {
+    for (int i = 0; i < n; i++) if (d[1LL * i * np + i] < 0) return true;
+    return false;
+  }
+  // c = min(c, a (x) b) on B x B tiles with row stride ld, k goes outermost so that c may alias a or b
+  template<bool P>
+  static void kernel(T *c, const T *a, const T *b, int ld, int *vc, int k0) {
+    for (int k = 0; k < B; k++) {
+      const T *bk = b + 1LL * k * ld;
+      for (int i = 0; i < B; i++) {
+        T aik = a[1LL * i * ld + k];
+        T *ci = c + 1LL * i * ld;
+        if (P) {
+          int *vi = vc + 1LL * i * ld;
+          for (int j = 0; j < B; j++) {
+            T x = aik + bk[j];
+            if (x < ci[j]) ci[j] = x, vi[j] = k0 + k;
+          }
+        } else {
+          for (int j = 0; j < B; j++) ci[j] = min(ci[j], aik + bk[j]);
+        }
+      }
+    }
+  }
+  // same but c doesn't alias a or b, so a row of c stays in registers while k runs
+  static void kernel_min_plus(T *__restrict c, const T *__restrict a, const T *__restrict b, int ld) {
+    for (int i = 0; i < B; i++) {
+      T *ci = c + 1LL * i * ld;
+      const T *ai = a + 1LL * i * ld;
+      T row[B];
+      for (int j = 0; j < B; j++) row[j] = ci[j];
+      for (int k = 0; k < B; k++) {
+        T aik = ai[k];
+        const T *bk = b + 1LL * k * ld;
+        for (int j = 0; j < B; j++) row[j] = min(row[j], aik + bk[j]);
+      }
+      for (int j = 0; j < B; j++) ci[j] = row[j];
+    }
+  }
+  void tile(int ib, int jb, int kb) {
+    long long ci = 1LL * ib * B * np + jb * B;
+    T *c = d.data() + ci;
+    const T *a = d.data() + 1LL * ib * B * np + kb * B;
+    const T *b = d.data() + 1LL * kb * B * np + jb * B;
+    if (path) kernel<true>(c, a, b, np, via.data() + ci, kb * B);
+    else if (ib != kb && jb != kb) kernel_min_plus(c, a, b, np);
+    else kernel<false>(c, a, b, np, nullptr, kb * B);
+  }
+  // runs f(0), f(1), ..., f(cnt - 1) on the thread pool
+  template<typename F>
+  void parallel_for(int cnt, F f) {
+    if (threads == 1 || cnt == 1) {
+      for (int i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<int> nxt(0);
+    vector<thread> pool;
+    for (int t = 0; t < min(threads, cnt); t++) {
+      pool.emplace_back([&]() {
+        for (int i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+  void solve() {
+    int nb = np / B;
+    for (int kb = 0; kb < nb; kb++) {
+      tile(kb, kb, kb);
+      parallel_for(2 * nb, [&](int x) {
+        int y = x >> 1;
+        if (y == kb) return;
+        if (x & 1) tile(y, kb, kb);
+        else tile(kb, y, kb);
+      });
+      parallel_for(nb * nb, [&](int x) {
+        int ib = x / nb, jb = x % nb;
+        if (ib != kb && jb != kb) tile(ib, jb, kb);
+      });
+    }
+  }
+  // nodes on the shortest path from u to v, empty if unreachable, needs path = true and no negative cycle
+  vector<int> get_path(int u, int v) {
+    assert(path);
+    if (dist(u, v) >= inf) return {};
+    vector<int> ans = {u};
+    vector<pair<int, int>> st = {{u, v}};
+    while (!st.empty()) {
+      auto [x, y] = st.back();
+      st.pop_back();
+      int k = via[1LL * x * np + y];
+      if (k == -1) {
+        if (x != y) ans.push_back(y);
+        continue;
+      }
+      st.push_back({k, y});
+      st.push_back({x, k});
+    }
+    return ans;
+  }
+  // min-plus product of a (n x m) and b (m x p) matrices given in row-major order
+  static vector<T> min_plus(const vector<T> &a, const vector<T> &b, int n, int m, int p, int threads = 1) {
+    const T inf = numeric_limits<T>::max() / 2;
+    int n2 = (n + B - 1) / B * B, m2 = (m + B - 1) / B * B, p2 = (p + B - 1) / B * B;
+    int ld = max({n2, m2, p2});
+    vector<T> A(1LL * n2 * ld, inf), Bm(1LL * m2 * ld, inf), C(1LL * n2 * ld, inf);
+    for (int i = 0; i < n; i++) copy(a.begin() + 1LL * i * m, a.begin() + 1LL * (i + 1) * m, A.begin() + 1LL * i * ld);
+    for (int i = 0; i < m; i++) copy(b.begin() + 1LL * i * p, b.begin() + 1LL * (i + 1) * p, Bm.begin() + 1LL * i * ld);
+    int rb = n2 / B, cb = p2 / B, kbs = m2 / B;
+    APSP<T> tmp;
+    tmp.threads = max(1, threads);
+    tmp.parallel_for(rb * cb, [&](int x) {
+      int ib = x / cb, jb = x % cb;
+      for (int kb = 0; kb < kbs; kb++) {
+        kernel_min_plus(C.data() + 1LL * ib * B * ld + jb * B, A.data() + 1LL * ib * B * ld + kb * B,
+                        Bm.data() + 1LL * kb * B * ld + jb * B, ld);
+      }
+    });
+    vector<T> ans(1LL * n * p);
+    for (int i = 0; i < n; i++) copy(C.begin() + 1LL * i * ld, C.begin() + 1LL * i * ld + p, ans.begin() + 1LL * i * p);
+    return ans;
+  }
+};
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m, q;
+  cin >> n >> m >> q;
+  APSP<long long> G(n, true, thread::hardware_concurrency());
+  for (int i = 0; i < m; i++) {
+    int u, v, w;
+    cin >> u >> v >> w;
+    --u; --v;
+    G.add_edge(u, v, w);
+    G.add_edge(v, u, w);
+  }
+  G.solve();
+  while (q--) {
+    int u, v;
+    cin >> u >> v;
+    --u; --v;
+    if (G.dist(u, v) >= G.inf) {
+      cout << -1 << '\n';
+      continue;
+    }
+    cout << G.dist(u, v) << '\n';
+  }
+  return 0;
+}
+// https://cses.fi/problemset/task/1672
@@ -0,0 +1,299 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Assignment Problem with runtime sizing, two solvers with the same interface as Hungarian
+Both find the minimum cost matching among the maximum cardinality matchings
+For maximum cost matching add -cost and take -solve()
+l[i] = matched right node of left node i (0 if none), r[j] = matched left node of right node j (0 if none)
+1-indexed
+*/
+
+/* Dense: Jonker-Volgenant style solver
+Column reduction for the initial matching (square case) and then shortest augmenting paths
+Costs are kept in one flat (n + 1) * (m + 1) array, missing edges are inf
+Complexity: O(n^2 m) where n = min(n1, n2), m = max(n1, n2), way faster in practice */
+struct JonkerVolgenant {
+  int n1, n2, n, m;
+  bool flipped;
+  vector<long long> c;
+  vector<int> l, r;
+  const long long inf = 1e18;
+  JonkerVolgenant() {}
+  JonkerVolgenant(int _n1, int _n2): n1(_n1), n2(_n2) {
+    flipped = n1 > n2;
+    n = min(n1, n2);
+    m = max(n1, n2);
+    c.assign(1LL * (n + 1) * (m + 1), inf);
+    l.assign(n1 + 1, 0);
+    r.assign(n2 + 1, 0);
+  }
+  inline long long &cost(int i, int j) {
+    return c[1LL * i * (m + 1) + j];
+  }
+  void add_edge(int u, int v, long long w) {
+    if (flipped) swap(u, v);
+    cost(u, v) = min(cost(u, v), w);
+  }
+  long long solve() {
+    vector<long long> u(n + 1, 0), v(m + 1, 0), minv(m + 1);
+    vector<int> p(m + 1, 0), way(m + 1, 0);
+    vector<bool> used(m + 1), has(n + 1, false);
+    if (n == m) { // column reduction, every column will be matched so this keeps optimality
+      for (int j = 1; j <= m; j++) {
+        int arg = 1;
+        for (int i = 2; i <= n; i++) if (cost(i, j) < cost(arg, j)) arg = i;
+        v[j] = cost(arg, j);
+        if (!has[arg]) {
+          has[arg] = true;
+          p[j] = arg;
+        }
+      }
+    }
+    for (int i = 1; i <= n; i++) {
+      if (has[i]) continue;
+      p[0] = i;
+      int j0 = 0;
+      fill(minv.begin(), minv.end(), LLONG_MAX);
+      fill(used.begin(), used.end(), false);
+      do {
+        used[j0] = true;
+        int i0 = p[j0], j1 = 0;
+        long long delta = LLONG_MAX;
+        for (int j = 1; j <= m; j++) {
+          if (used[j]) continue;
+          long long cur = cost(i0, j) - u[i0] - v[j];
+          if (cur < minv[j]) {
+            minv[j] = cur;
+            way[j] = j0;
+          }
+          if (minv[j] < delta) {
+            delta = minv[j];
+            j1 = j;
+          }
+        }
+        for (int j = 0; j <= m; j++) {
+          if (used[j]) {
+            u[p[j]] += delta;
+            v[j] -= delta;
+          } else minv[j] -= delta;
+        }
+        j0 = j1;
+      } while (p[j0] != 0);
+      do {
+        int j1 = way[j0];
+        p[j0] = p[j1];
+        j0 = j1;
+      } while (j0);
+    }
+    long long ans = 0;
+    for (int j = 1; j <= m; j++) {
+      int i = p[j];
+      if (!i || cost(i, j) == inf) continue;
+      ans += cost(i, j);
+      if (flipped) l[j] = i, r[i] = j;
+      else l[i] = j, r[j] = i;
+    }
+    return ans;
+  }
+};
+
+/* Sparse: Auction algorithm with eps-scaling, only the given edges are stored
+The problem is made square and always feasible with n1 + n2 nodes per side:
+left i can go to its own dummy (cost big), dummy of right j can take j (cost 0)
+or the dummy of left i for every edge (i, j) (cost 0)
+Benefits are multiplied by n1 + n2 + 1 so that the final phase with eps = 1 is optimal
+Bidding rounds can run in parallel (Jacobi auction) by passing threads > 1: the workers live for the whole
+solve() and meet at a barrier after every round of >= 1024 bids (smaller rounds are done by one thread).
+Jacobi needs more rounds than Gauss-Seidel (one bid at a time), so it only pays off with real cores
+to spare and large instances (thousands of persons per round), with threads = 1 or 2 keep Gauss-Seidel
+Complexity: O(n E log(n C)) in theory, close to O(E log(n C)) on random sparse instances
+Keep (n1 + n2)^2 * max|cost| below 1e18 */
+struct Auction {
+  int n1, n2;
+  vector<array<long long, 3>> edges;
+  vector<int> l, r;
+  // csr arcs of the square instance
+  vector<int> st, obj, orig;
+  vector<long long> ben, price;
+  vector<int> owner, match;
+  long long eps, range;
+  Auction() {}
+  Auction(int _n1, int _n2): n1(_n1), n2(_n2) {
+    l.assign(n1 + 1, 0);
+    r.assign(n2 + 1, 0);
+  }
+  void add_edge(int u, int v, long long w) {
+    edges.push_back({u - 1, v - 1, w});
+  }
+  // best object of person i, returns {object, new price}
+  pair<int, long long> bid(int i) {
+    int best = -1;
+    long long w1 = LLONG_MIN, w2 = LLONG_MIN;
+    for (int k = st[i]; k < st[i + 1]; k++) {
+      long long val = ben[k] - price[obj[k]];
+      if (val > w1) {
+        w2 = w1;
+        w1 = val;
+        best = obj[k];
+      } else if (val > w2) w2 = val;
+    }
+    long long inc = w2 == LLONG_MIN ? range + eps : w1 - w2 + eps;
+    return {best, price[best] + inc};
+  }
+  void take(int i, int j, long long p, vector<int> &q) {
+    price[j] = p;
+    if (owner[j] != -1) {
+      match[owner[j]] = -1;
+      q.push_back(owner[j]);
+    }
+    owner[j] = i;
+    match[i] = j;
+  }
+  // threads - 1 workers kept for the whole solve(), run(f) calls f(t) on every thread t and waits for all
+  struct Workers {
+    int th;
+    atomic<int> gen{0}, done{0};
+    atomic<bool> stop{false};
+    function<void(int)> job;
+    vector<thread> pool;
+    Workers(int _th): th(_th) {
+      for (int t = 1; t < th; t++) {
+        pool.emplace_back([this, t]() {
+          for (int seen = 0; ; seen++) {
+            while (gen.load(memory_order_acquire) == seen && !stop) this_thread::yield();
+            if (stop) return;
+            job(t);
+            done.fetch_add(1, memory_order_release);
+          }
+        });
+      }
+    }
+    void run(const function<void(int)> &f) {
+      job = f;
+      done = 0;
+      gen.fetch_add(1, memory_order_release);
+      job(0);
+      while (done.load(memory_order_acquire) != th - 1) this_thread::yield();
+    }
+    ~Workers() {
+      stop = true;
+      for (auto &t : pool) t.join();
+    }
+  };
+  void phase(Workers *W) {
+    int N = n1 + n2;
+    owner.assign(N, -1);
+    match.assign(N, -1);
+    vector<int> q(N);
+    iota(q.rbegin(), q.rend(), 0);
+    if (!W) { // Gauss-Seidel: one bid at a time
+      while (!q.empty()) {
+        int i = q.back();
+        q.pop_back();
+        auto [j, p] = bid(i);
+        take(i, j, p, q);
+      }
+      return;
+    }
+    vector<pair<int, long long>> bids;
+    vector<int> winner(N, -1), nq;
+    while (!q.empty()) {
+      int k = q.size();
+      bids.assign(k, {-1, 0});
+      if (k >= 1024) {
+        int th = W->th;
+        W->run([&](int t) {
+          for (int x = t; x < k; x += th) bids[x] = bid(q[x]);
+        });
+      } else for (int x = 0; x < k; x++) bids[x] = bid(q[x]);
+      nq.clear();
+      for (int x = 0; x < k; x++) {
+        int j = bids[x].first;
+        if (winner[j] == -1 || bids[x].second > bids[winner[j]].second) {
+          if (winner[j] != -1) nq.push_back(q[winner[j]]);
+          winner[j] = x;
+        } else nq.push_back(q[x]);
+      }
+      for (int x = 0; x < k; x++) {
+        int j = bids[x].first;
+        if (winner[j] == x) {
+          take(q[x], j, bids[x].second, nq);
+          winner[j] = -1;
+        }
+      }
+      swap(q, nq);
+    }
+  }
+  long long solve(int threads = 1) {
+    int N = n1 + n2;
+    long long mx = 1;
+    for (auto &e : edges) mx = max(mx, abs(e[2]));
+    long long big = (min(n1, n2) + 1) * (2 * mx + 1), scale = N + 1;
+    vector<array<long long, 4>> arcs; // person, object, benefit, original edge
+    for (int k = 0; k < (int)edges.size(); k++) {
+      auto [i, j, w] = edges[k];
+      arcs.push_back({i, j, -w * scale, k});
+      arcs.push_back({n1 + j, n2 + i, 0, -1});
+    }
+    for (int i = 0; i < n1; i++) arcs.push_back({i, n2 + i, -big * scale, -1});
+    for (int j = 0; j < n2; j++) arcs.push_back({n1 + j, j, 0, -1});
+    st.assign(N + 1, 0);
+    for (auto &a : arcs) st[a[0] + 1]++;
+    for (int i = 0; i < N; i++) st[i + 1] += st[i];
+    obj.resize(arcs.size());
+    ben.resize(arcs.size());
+    orig.resize(arcs.size());
+    vector<int> pos(st.begin(), st.end() - 1);
+    long long lo = 0, hi = 0;
+    for (auto &a : arcs) {
+      int k = pos[a[0]]++;
+      obj[k] = a[1];
+      ben[k] = a[2];
+      orig[k] = a[3];
+      lo = min(lo, a[2]);
+      hi = max(hi, a[2]);
+    }
+    range = hi - lo;
+    price.assign(N, 0);
+    eps = max(1LL, range / 4);
+    unique_ptr<Workers> W;
+    if (threads > 1) W = make_unique<Workers>(threads);
+    while (true) {
+      phase(W.get());
+      if (eps == 1) break;
+      eps = max(1LL, eps / 5);
+    }
+    long long ans = 0;
+    for (int i = 0; i < n1; i++) {
+      int j = match[i];
+      if (j >= n2) continue;
+      // the cheapest parallel edge to j
+      long long w = LLONG_MAX;
+      for (int k = st[i]; k < st[i + 1]; k++) if (obj[k] == j) w = min(w, edges[orig[k]][2]);
+      ans += w;
+      l[i + 1] = j + 1;
+      r[j + 1] = i + 1;
+    }
+    return ans;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n1, n2, m;
+  cin >> n1 >> n2 >> m;
+  JonkerVolgenant J(n1, n2);
+  Auction A(n1, n2);
+  for (int i = 1; i <= m; i++) {
+    int u, v, w;
+    cin >> u >> v >> w;
+    J.add_edge(u, v, -w);
+    A.add_edge(u, v, -w);
+  }
+  long long ans = -J.solve();
+  assert(ans == -A.solve());
+  cout << ans << '\n';
+  for (int i = 1; i <= n1; i++) cout << J.l[i] << ' ';
+  return 0;
+}
@@ -0,0 +1,450 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Maximum matching on a general graph, sized at runtime, adjacency in CSR, no recursion in the searches
+Warm start: a greedy matching (low degree vertices first, matched to their lowest degree free neighbour)
+or a matching given by the caller, usually most of the answer is already there
+Fast phases like Hopcroft-Karp: an alternating forest is grown from all the free vertices at once
+with Edmonds' blossom shrinking (dsu on the bases), every edge between two outer vertices of
+different trees is an augmenting path, it is augmented and both trees are frozen for the rest of the phase,
+so one phase finds many vertex disjoint augmenting paths in O(m α(n)), a phase without any is a full
+Edmonds search and the matching is maximum; their paths are not always the shortest ones, so there is
+no bound on their number and only the first sqrt(n) of them are run
+Then Micali-Vazirani phases: bfs levels (even/odd) from all the free vertices, bridges by tenacity,
+a double dfs per bridge gives a petal (its vertices get their max level and the bottleneck as bud)
+or an augmenting path, the vertices of an augmenting path are erased with everything that only hangs
+from them, so a phase finds a maximal set of vertex disjoint shortest augmenting paths in O(m),
+and O(sqrt(n)) phases are enough; the paths through petals are rebuilt with a flow of value 2 on the
+petal, each petal is opened at most once per phase
+Complexity: O(m sqrt(n)), 1e5 vertices and 1e6 edges run in well under a second
+0-indexed, match[v] = -1 if v is free
+*/
+struct Matching {
+  int n;
+  vector<pair<int, int>> edges;
+  vector<int> st, adj, match;
+  static constexpr int INF = INT_MAX / 2;
+  vector<int> par, base, vis, root, aux, q; // vis: -1 unlabeled, 0 outer, 1 inner
+  vector<char> dead;
+  // one phase: lvl[0][v] / lvl[1][v] even / odd level of v, bud (dsu) and budd (direct) the bud of the petal of v
+  vector<int> lvl[2], bud, budd, pid, col, it, itst, cnt, mark, loc;
+  vector<char> erased;
+  vector<vector<int>> pred, succ, hang, layer, pmem;
+  vector<vector<pair<int, int>>> bridges;
+  vector<array<int, 3>> pinfo; // bridge ends and bud of the petal found by every ddfs
+  struct Piece {
+    int type, x, L, y; // 0: the vertex x, 1: x at level L down to y, 2: x at its max level down to its bud
+    bool rev;
+  };
+  vector<Piece> todo; // the pieces of the augmenting path still to write
+  vector<int> touched; // the vertices with a level, only they are reset for the next phase
+  int did, hi, stamp = 0;
+  Matching() {}
+  Matching(int _n): n(_n) {}
+  void add_edge(int u, int v) {
+    if (u != v) edges.emplace_back(u, v);
+  }
+  void build_csr() {
+    st.assign(n + 1, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, st[v + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    adj.resize(st[n]);
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (auto &[u, v] : edges) adj[pos[u]++] = v, adj[pos[v]++] = u;
+  }
+  void greedy() {
+    vector<int> ord(n);
+    iota(ord.begin(), ord.end(), 0);
+    auto deg = [&](int v) {
+      return st[v + 1] - st[v];
+    };
+    sort(ord.begin(), ord.end(), [&](int a, int b) {
+      return deg(a) < deg(b);
+    });
+    for (int u : ord) {
+      if (match[u] != -1) continue;
+      int best = -1;
+      for (int i = st[u]; i < st[u + 1]; i++) {
+        int v = adj[i];
+        if (match[v] == -1 && (best == -1 || deg(v) < deg(best))) best = v;
+      }
+      if (best != -1) match[u] = best, match[best] = u;
+    }
+  }
+  int find(int x) {
+    while (base[x] != x) x = base[x] = base[base[x]];
+    return x;
+  }
+  // v and w are bases of outer blossoms in the same tree
+  int lca(int v, int w) {
+    ++stamp;
+    while (true) {
+      if (v != -1) {
+        if (aux[v] == stamp) return v;
+        aux[v] = stamp;
+        v = match[v] == -1 ? -1 : find(par[match[v]]);
+      }
+      swap(v, w);
+    }
+  }
+  void blossom(int v, int w, int a) {
+    while (find(v) != a) {
+      par[v] = w;
+      w = match[v];
+      if (vis[w] == 1) vis[w] = 0, q.push_back(w);
+      if (base[v] == v) base[v] = a;
+      if (base[w] == w) base[w] = a;
+      v = par[w];
+    }
+  }
+  // flips the alternating path from the outer vertex b to its root, b is left free
+  void flip(int b) {
+    int y = match[b];
+    while (y != -1) {
+      int z = par[y], w = match[z];
+      match[y] = z;
+      match[z] = y;
+      y = w;
+    }
+  }
+  // Hopcroft-Karp like phase with Edmonds' blossoms, the paths found are not always the shortest ones
+  bool fast_phase() {
+    vis.assign(n, -1);
+    root.assign(n, -1);
+    dead.assign(n, 0);
+    iota(base.begin(), base.end(), 0);
+    q.clear();
+    for (int v = 0; v < n; v++) if (match[v] == -1) vis[v] = 0, root[v] = v, q.push_back(v);
+    bool found = false;
+    for (int h = 0; h < (int)q.size(); h++) {
+      int v = q[h];
+      if (dead[root[v]]) continue;
+      for (int i = st[v]; i < st[v + 1]; i++) {
+        int x = adj[i];
+        if (vis[x] == -1) { // x is matched, its mate is unlabeled too
+          int y = match[x];
+          par[x] = v;
+          vis[x] = 1, vis[y] = 0;
+          root[x] = root[y] = root[v];
+          q.push_back(y);
+        } else if (vis[x] == 0 && !dead[root[x]]) {
+          if (root[x] != root[v]) {
+            dead[root[v]] = dead[root[x]] = 1;
+            flip(v);
+            flip(x);
+            match[v] = x, match[x] = v;
+            found = true;
+            break;
+          }
+          int bv = find(v), bx = find(x);
+          if (bv != bx) {
+            int a = lca(bv, bx);
+            blossom(x, v, a);
+            blossom(v, x, a);
+          }
+        }
+      }
+    }
+    return found;
+  }
+  inline int minlvl(int v) {
+    return min(lvl[0][v], lvl[1][v]);
+  }
+  int bud_of(int x) {
+    while (bud[x] != x) x = bud[x] = bud[bud[x]];
+    return x;
+  }
+  void erase(int x) {
+    vector<int> stk = {x};
+    erased[x] = 1;
+    while (!stk.empty()) {
+      int u = stk.back();
+      stk.pop_back();
+      for (int y : succ[u]) if (!erased[y] && --cnt[y] == 0) erased[y] = 1, stk.push_back(y);
+    }
+  }
+  void add_bridge(int u, int w, int tn) {
+    int i = (tn - 1) / 2;
+    if (i < n) bridges[i].emplace_back(u, w), hi = max(hi, i);
+  }
+  void add_level(int v, int L) {
+    lvl[L & 1][v] = L;
+    if (L < n) layer[L].push_back(v), hi = max(hi, L);
+  }
+  // one step of the finger on s1, -1 or the bottleneck
+  int ddfs_move(vector<int> &s1, int c1, vector<int> &s2, vector<int> &support) {
+    int u = s1.back();
+    if (itst[u] != did) itst[u] = did, it[u] = 0;
+    for (; it[u] < (int)pred[u].size(); it[u]++) {
+      int a = pred[u][it[u]];
+      if (erased[a]) continue;
+      int v = bud_of(a);
+      if (erased[v] || col[v] >= 2 * did) continue;
+      col[v] = c1;
+      s1.push_back(v);
+      support.push_back(v);
+      it[u]++;
+      return -1;
+    }
+    s1.pop_back();
+    if (s1.empty()) {
+      if (s2.size() == 1) { // the other finger cannot move away either
+        col[s2[0]] = 0;
+        return s2[0];
+      }
+      s1.push_back(s2.back());
+      col[s2.back()] = c1;
+      s2.pop_back();
+    }
+    return -1;
+  }
+  // double dfs from the bridge (u, w): -1 augmenting path (the fingers end at two free vertices), else the bottleneck
+  int ddfs(int u, int w, vector<int> &support, vector<int> &sr, vector<int> &sg) {
+    sr = {bud_of(u)}, sg = {bud_of(w)};
+    support = {sr[0], sg[0]};
+    col[sr[0]] = 2 * did, col[sg[0]] = 2 * did + 1;
+    while (true) {
+      if (minlvl(sr.back()) == 0 && minlvl(sg.back()) == 0) return -1;
+      int b = minlvl(sr.back()) >= minlvl(sg.back()) ? ddfs_move(sr, 2 * did, sg, support)
+              : ddfs_move(sg, 2 * did + 1, sr, support);
+      if (b != -1) return b;
+    }
+  }
+  // two vertex disjoint descents from the nodes s0 and t0 to two different sinks, through the nodes only,
+  // top(a) is the node of the predecessor a, a unit capacity flow of value 2
+  template<class F, class S>
+  void two_paths(const vector<int> &nodes, int s0, int t0, F top, S sink, vector<pair<int, int>> path[2]) {
+    int N = nodes.size(), S_ = 2 * N, T_ = 2 * N + 1;
+    ++stamp;
+    for (int i = 0; i < N; i++) mark[nodes[i]] = stamp, loc[nodes[i]] = i;
+    vector<int> head(2 * N + 2, -1), to, nxt, cap, via;
+    auto add = [&](int a, int b, int v) {
+      to.push_back(b), nxt.push_back(head[a]), cap.push_back(1), via.push_back(v), head[a] = to.size() - 1;
+      to.push_back(a), nxt.push_back(head[b]), cap.push_back(0), via.push_back(-1), head[b] = to.size() - 1;
+    };
+    for (int i = 0; i < N; i++) {
+      int u = nodes[i];
+      add(2 * i, 2 * i + 1, -1);
+      if (sink(u)) {
+        add(2 * i + 1, T_, -1);
+        continue;
+      }
+      for (int a : pred[u]) {
+        if (erased[a]) continue;
+        int v = top(a);
+        if (mark[v] == stamp && !erased[v]) add(2 * i + 1, 2 * loc[v], a);
+      }
+    }
+    add(S_, 2 * loc[s0], -1);
+    add(S_, 2 * loc[t0], -1);
+    vector<int> seen(2 * N + 2), pe(2 * N + 2), stk;
+    for (int r = 1; r <= 2; r++) {
+      stk = {S_};
+      seen[S_] = r;
+      while (!stk.empty() && seen[T_] != r) {
+        int x = stk.back();
+        stk.pop_back();
+        for (int e = head[x]; e != -1; e = nxt[e]) if (cap[e] && seen[to[e]] != r) {
+          seen[to[e]] = r, pe[to[e]] = e;
+          stk.push_back(to[e]);
+        }
+      }
+      for (int x = T_; x != S_; x = to[pe[x] ^ 1]) cap[pe[x]]--, cap[pe[x] ^ 1]++;
+    }
+    for (int k = 0; k < 2; k++) {
+      int i = loc[k ? t0 : s0];
+      path[k].clear();
+      while (true) {
+        int e = head[2 * i + 1];
+        while (via[e] == -1 || cap[e]) {
+          if (to[e] == T_ && !cap[e]) break;
+          e = nxt[e];
+        }
+        if (to[e] == T_) break;
+        i = to[e] / 2;
+        path[k].emplace_back(nodes[i], via[e]);
+      }
+    }
+  }
+  // the bridge end e down to the node e0, then along the node path
+  void expand(int e, int w, int e0, const vector<pair<int, int>> &path, vector<Piece> &seq) {
+    seq.push_back({1, e, lvl[match[e] == w][e], e0, false});
+    for (auto [v, a] : path) seq.push_back({1, a, minlvl(e0) - 1, v, false}), e0 = v;
+  }
+  // a reversed then b (b reversed then a if rev), on the stack the last piece goes first
+  void push_halves(vector<Piece> &a, vector<Piece> &b, bool rev) {
+    if (!rev) {
+      for (int i = b.size() - 1; i >= 0; i--) todo.push_back(b[i]);
+      for (auto x : a) x.rev ^= 1, todo.push_back(x);
+    } else {
+      for (int i = a.size() - 1; i >= 0; i--) todo.push_back(a[i]);
+      for (auto x : b) x.rev ^= 1, todo.push_back(x);
+    }
+  }
+  // writes the vertices of the pieces on the stack, the same vertex twice in a row (a bud where a petal
+  // ends and the descent goes on) is written once
+  void unfold(vector<int> &out) {
+    vector<Piece> seq, a, b;
+    while (!todo.empty()) {
+      auto [type, x, L, y, rev] = todo.back();
+      todo.pop_back();
+      if (type == 0) {
+        if (out.empty() || out.back() != x) out.push_back(x);
+      } else if (type == 1) {
+        // x at level L down to y along predecessors, every descent from x passes through y (a bud below x),
+        // a vertex needed at its max level goes through its petal
+        seq.clear();
+        while (true) {
+          if (L != minlvl(x)) {
+            seq.push_back({2, x, 0, 0, false});
+            x = budd[x], L = minlvl(x);
+            continue;
+          }
+          seq.push_back({0, x, 0, 0, false});
+          if (x == y) break;
+          int i = 0;
+          while (erased[pred[x][i]]) i++;
+          x = pred[x][i], L--;
+        }
+        if (rev) for (auto z : seq) z.rev = true, todo.push_back(z);
+        else for (int i = seq.size() - 1; i >= 0; i--) todo.push_back(seq[i]);
+      } else {
+        // x at its max level down to the bud of its petal: up to one end of the bridge, across it,
+        // and down from the other end
+        int d = pid[x];
+        auto [s, t, bd] = pinfo[d];
+        auto top = [&](int v) {
+          while (pid[v] != d && v != bd && budd[v] != v) v = budd[v];
+          return v;
+        };
+        vector<int> nodes = pmem[d];
+        nodes.push_back(bd);
+        vector<pair<int, int>> path[2];
+        two_paths(nodes, top(s), top(t), top, [&](int v) {
+          return v == x || v == bd;
+        }, path);
+        int k = (path[0].empty() ? top(s) : path[0].back().first) == x ? 0 : 1;
+        int ex = k ? t : s, eb = k ? s : t;
+        a.clear(), b.clear();
+        expand(ex, eb, top(ex), path[k], a);
+        expand(eb, ex, top(eb), path[k ^ 1], b);
+        push_halves(a, b, rev);
+      }
+    }
+  }
+  // Micali-Vazirani phase: a maximal set of vertex disjoint shortest augmenting paths in O(m)
+  bool phase() {
+    for (int v : touched) {
+      lvl[0][v] = lvl[1][v] = INF;
+      bud[v] = budd[v] = v;
+      pid[v] = itst[v] = -1;
+      col[v] = cnt[v] = erased[v] = 0;
+      pred[v].clear(), succ[v].clear(), hang[v].clear();
+    }
+    for (int i = 0; i <= hi; i++) layer[i].clear(), bridges[i].clear();
+    touched.clear(), pinfo.clear(), pmem.clear();
+    did = hi = 0;
+    for (int v = 0; v < n; v++) if (match[v] == -1) touched.push_back(v), add_level(v, 0);
+    vector<int> support, sr, sg, p;
+    vector<pair<int, int>> path[2];
+    bool found = false;
+    for (int i = 0; i <= hi && !found; i++) {
+      // min: the levels i + 1 from the vertices at level i, the edges between two vertices of the same parity are bridges
+      for (int v : layer[i]) {
+        if (erased[v]) continue;
+        int c = i & 1;
+        for (int j = st[v]; j < st[v + 1]; j++) {
+          int u = adj[j];
+          if ((u == match[v]) != c || lvl[c][u] + 1 == lvl[c ^ 1][v]) continue;
+          if (lvl[c][u] < INF) {
+            if ((lvl[c][u] + i) / 2 >= i) add_bridge(u, v, lvl[c][u] + i + 1);
+          } else if (lvl[c ^ 1][u] == INF) {
+            touched.push_back(u), add_level(u, i + 1);
+            pred[u].push_back(v), succ[v].push_back(u), cnt[u]++;
+          } else if (lvl[c ^ 1][u] == i + 1) pred[u].push_back(v), succ[v].push_back(u), cnt[u]++;
+          else hang[u].push_back(v);
+        }
+      }
+      // max: the bridges of tenacity 2i + 1, each one gives a petal or an augmenting path
+      for (int j = 0; j < (int)bridges[i].size(); j++) {
+        auto [u, w] = bridges[i][j];
+        if (erased[u] || erased[w] || bud_of(u) == bud_of(w) || erased[bud_of(u)] || erased[bud_of(w)]) continue;
+        ++did;
+        pinfo.push_back({u, w, -1});
+        pmem.emplace_back();
+        int b = ddfs(u, w, support, sr, sg);
+        if (b == -1) {
+          two_paths(support, bud_of(u), bud_of(w), [&](int a) {
+            return bud_of(a);
+          }, [&](int v) {
+            return minlvl(v) == 0;
+          }, path);
+          vector<Piece> a, c;
+          expand(u, w, bud_of(u), path[0], a);
+          expand(w, u, bud_of(w), path[1], c);
+          push_halves(a, c, false);
+          p.clear();
+          unfold(p);
+          for (int k = 0; k + 1 < (int)p.size(); k += 2) match[p[k]] = p[k + 1], match[p[k + 1]] = p[k];
+          for (int x : p) if (!erased[x]) erase(x);
+          found = true;
+          continue;
+        }
+        pinfo.back()[2] = b;
+        for (int x : support) {
+          if (x == b) continue;
+          bud[x] = budd[x] = b;
+          pid[x] = did - 1;
+          int L = 2 * i + 1 - minlvl(x);
+          add_level(x, L);
+          for (int y : hang[x]) add_bridge(x, y, L + lvl[L & 1][y] + 1);
+          pmem.back().push_back(x);
+        }
+      }
+    }
+    return found;
+  }
+  // init: a valid matching to start from (match[v] = -1 if free), greedy if empty
+  int maximum_matching(const vector<int> &init = {}) {
+    build_csr();
+    for (int c = 0; c < 2; c++) lvl[c].assign(n, INF);
+    bud.resize(n), budd.resize(n), it.resize(n), loc.resize(n);
+    iota(bud.begin(), bud.end(), 0);
+    iota(budd.begin(), budd.end(), 0);
+    pid.assign(n, -1), itst.assign(n, -1), col.assign(n, 0), cnt.assign(n, 0), erased.assign(n, 0);
+    touched.clear(), hi = 0;
+    mark.assign(n, 0);
+    par.assign(n, -1), base.assign(n, 0), aux.assign(n, 0);
+    pred.assign(n, {}), succ.assign(n, {}), hang.assign(n, {}), layer.assign(n, {}), bridges.assign(n, {});
+    if (init.empty()) {
+      match.assign(n, -1);
+      greedy();
+    } else match = init;
+    // the fast phases find most of the paths, after sqrt(n) of them the phases with the bound take over
+    for (int k = 0; k * k < n; k++) if (!fast_phase()) return count();
+    while (phase());
+    return count();
+  }
+  int count() {
+    int ans = 0;
+    for (int v = 0; v < n; v++) ans += match[v] > v;
+    return ans;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m;
+  cin >> n >> m;
+  Matching M(n);
+  while (m--) {
+    int u, v;
+    cin >> u >> v;
+    M.add_edge(u, v);
+  }
+  cout << M.maximum_matching() << '\n';
+  for (int v = 0; v < n; v++) if (M.match[v] > v) cout << v << ' ' << M.match[v] << '\n';
+  return 0;
+}
+// https://judge.yosupo.jp/problem/general_matching
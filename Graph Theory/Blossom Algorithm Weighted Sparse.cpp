@@ -0,0 +1,453 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Maximum weight matching on a general graph with sparse edge storage, O(n + m) memory
+and sized at runtime, no n^2 tables like the dense version
+Primal-dual Edmonds: vertex duals start at max weight (doubled so that everything stays integral),
+slack(e) = y[u] + y[v] - 2w(e), blossoms get their own duals
+Blossom V style dual updates: the alternating trees are kept between augmentations (an augmentation
+only frees its two trees), every dual of the trees moves by the same global delta G so nothing is
+touched on an update, and the next delta comes from priority queues of S-free edges, S-S edges and
+T blossoms whose entries are checked lazily; tight edges skip the queues
+The vertices of a top blossom share a group with one dual offset, a new or expanded blossom keeps
+the group of its largest child, so labels are O(1) and only the smaller children are renumbered
+Edges are referenced by endpoint ids p = 2 * edge + side, endp(p) is the vertex at that side
+With max_cardinality = true it returns a maximum weight matching among the maximum cardinality ones
+Warm start: a greedy matching on the edges of maximum weight (the only ones tight under the initial duals)
+Complexity: O(n m log m) in the worst case, in practice random graphs with 1e5 vertices and 1e6 edges take
+0.1 s (weights 1), 0.5 s (weights 1..2), 4.5 s (weights 1..100 or 1..1e6)
+0-indexed, works with negative weights too
+*/
+struct WeightedMatching {
+  using T = long long;
+  using Q = priority_queue<pair<T, int>, vector<pair<T, int>>, greater<pair<T, int>>>;
+  int n;
+  vector<int> eu, ev;
+  vector<T> ew;
+  vector<int> st, nb; // endpoints around every vertex in CSR
+  vector<int> mate, label, labelend, bpar, bbase, bsz, unused, q, tree, freed;
+  vector<int> grp, gtop, gid, gfree; // group of a vertex, top blossom of a group, group of a top blossom
+  vector<vector<int>> bch, bendps, tlist;
+  // vertex v: y = dual[v] + off[grp[v]] - G if its top blossom is S, + G if T
+  // top blossom b: z = dual[b] + G if S, - G if T, the others z = dual[b]
+  vector<T> dual, off;
+  T G, E; // sum of the deltas, dual of the free vertices
+  Q h2, h3, h4; // S-free edges (slack + G), S-S edges (slack + 2G), T blossoms (z + G)
+  vector<int> z2, z3; // the same edges when they are tight already, no heap needed for them
+  vector<int> match;
+  WeightedMatching() {}
+  WeightedMatching(int _n): n(_n) {}
+  void add_edge(int u, int v, T w) {
+    if (u == v) return;
+    eu.push_back(u);
+    ev.push_back(v);
+    ew.push_back(w);
+  }
+  inline int endp(int p) {
+    return p & 1 ? ev[p >> 1] : eu[p >> 1];
+  }
+  inline int top(int v) {
+    return gtop[grp[v]];
+  }
+  inline bool alive(int b) {
+    return b < n || bbase[b] >= 0;
+  }
+  // slack of k + G if it is S-free, + 2G if it is S-S
+  inline T key(int k) {
+    return dual[eu[k]] + off[grp[eu[k]]] + dual[ev[k]] + off[grp[ev[k]]] - 2 * ew[k];
+  }
+  void leaves(int b, vector<int> &out) {
+    vector<int> stk = {b};
+    while (!stk.empty()) {
+      int x = stk.back();
+      stk.pop_back();
+      if (x < n) out.push_back(x);
+      else for (int t : bch[x]) stk.push_back(t);
+    }
+  }
+  inline int at(int b, int j) {
+    int L = bch[b].size();
+    return (j % L + L) % L;
+  }
+  // new label of the top blossom b in O(1), the actual duals do not change
+  void relabel(int b, int t) {
+    auto sg = [](int l) {
+      return l == 1 ? -1 : l == 2 ? 1 : 0;
+    };
+    off[gid[b]] += (sg(label[b]) - sg(t)) * G;
+    if (b >= n) dual[b] += (sg(t) - sg(label[b])) * G;
+    label[b] = t;
+  }
+  // label t (1 = S, 2 = T) on the free top blossom b, in the tree of root
+  void set_label(int b, int t, int root) {
+    relabel(b, t);
+    tree[b] = root;
+    tlist[root].push_back(b);
+    if (t == 1) q.push_back(b);
+    else if (b >= n) h4.push({dual[b], b});
+  }
+  // S-free edge k, the entries of all the queues are checked against the current duals when they come out
+  void push2(int k) {
+    T x = key(k);
+    if (x == G) z2.push_back(k);
+    else h2.push({x, k});
+  }
+  bool ok2(int k, T x) {
+    int a = label[top(eu[k])], b = label[top(ev[k])];
+    return a + b == 1 && (a | b) == 1 && x == key(k);
+  }
+  // S-S edge k
+  void push3(int k) {
+    T x = key(k);
+    if (x == 2 * G) z3.push_back(k);
+    else h3.push({x, k});
+  }
+  bool ok3(int k, T x) {
+    int a = top(eu[k]), b = top(ev[k]);
+    return label[a] == 1 && label[b] == 1 && a != b && x == key(k);
+  }
+  // the edges from S vertices to the free vertex x
+  void scan_free(int x) {
+    for (int i = st[x]; i < st[x + 1]; i++) {
+      int k = nb[i] >> 1;
+      if (label[top(endp(nb[i]))] == 1) push2(k);
+    }
+  }
+  void assign_label(int w, int t, int p, int root) {
+    while (true) {
+      int b = top(w);
+      labelend[b] = p;
+      set_label(b, t, root);
+      if (t == 1) return;
+      int base = bbase[b];
+      w = endp(mate[base]);
+      t = 1;
+      p = mate[base] ^ 1;
+    }
+  }
+  // base of the new blossom if v and w are in the same tree, -1 if there is an augmenting path
+  int scan_blossom(int v, int w) {
+    vector<int> path;
+    int base = -1;
+    while (v != -1 || w != -1) {
+      int b = top(v);
+      if (label[b] & 4) {
+        base = bbase[b];
+        break;
+      }
+      path.push_back(b);
+      label[b] = 5;
+      if (labelend[b] == -1) v = -1;
+      else {
+        v = endp(labelend[b]);
+        b = top(v);
+        v = endp(labelend[b]);
+      }
+      if (w != -1) swap(v, w);
+    }
+    for (int b : path) label[b] = 1;
+    return base;
+  }
+  // the blossom takes the group of its largest child, only the vertices of the others move
+  void add_blossom(int base, int k) {
+    int v = eu[k], w = ev[k];
+    int bb = top(base), bv = top(v), bw = top(w);
+    int b = unused.back();
+    unused.pop_back();
+    bbase[b] = base;
+    bpar[b] = -1;
+    bpar[bb] = b;
+    vector<int> &path = bch[b], &endps = bendps[b];
+    path.clear();
+    endps.clear();
+    while (bv != bb) {
+      bpar[bv] = b;
+      path.push_back(bv);
+      endps.push_back(labelend[bv]);
+      v = endp(labelend[bv]);
+      bv = top(v);
+    }
+    path.push_back(bb);
+    reverse(path.begin(), path.end());
+    reverse(endps.begin(), endps.end());
+    endps.push_back(2 * k);
+    while (bw != bb) {
+      bpar[bw] = b;
+      path.push_back(bw);
+      endps.push_back(labelend[bw] ^ 1);
+      w = endp(labelend[bw]);
+      bw = top(w);
+    }
+    // the T children become S and are scanned, then the duals of the children stop moving
+    int big = bb;
+    bsz[b] = 0;
+    for (int c : path) {
+      bsz[b] += bsz[c];
+      if (bsz[c] > bsz[big]) big = c;
+      if (label[c] == 2) q.push_back(c);
+      relabel(c, 1);
+    }
+    int g = gid[big];
+    vector<int> lv;
+    for (int c : path) {
+      label[c] = 0;
+      if (c >= n) dual[c] += G;
+      if (c == big) continue;
+      lv.clear();
+      leaves(c, lv);
+      for (int x : lv) dual[x] += off[gid[c]] - off[g], grp[x] = g;
+      gfree.push_back(gid[c]);
+    }
+    gid[b] = g, gtop[g] = b;
+    label[b] = 1;
+    labelend[b] = labelend[bb];
+    dual[b] = -G;
+    tree[b] = tree[bb];
+    tlist[tree[b]].push_back(b);
+  }
+  // T blossom b with a zero dual, its largest child keeps the group
+  void expand_blossom(int b) {
+    int root = tree[b], g = gid[b], big = bch[b][0];
+    relabel(b, 0);
+    for (int c : bch[b]) if (bsz[c] > bsz[big]) big = c;
+    vector<int> lv;
+    for (int c : bch[b]) {
+      bpar[c] = -1;
+      if (c == big) {
+        gid[c] = g, gtop[g] = c;
+        continue;
+      }
+      int h = gfree.back();
+      gfree.pop_back();
+      off[h] = 0, gid[c] = h, gtop[h] = c;
+      lv.clear();
+      leaves(c, lv);
+      for (int x : lv) dual[x] += off[g], grp[x] = h;
+    }
+    // relabel the children on the even path from the entry child to the base
+    int entry = top(endp(labelend[b] ^ 1));
+    int j = find(bch[b].begin(), bch[b].end(), entry) - bch[b].begin(), jstep, trick;
+    if (j & 1) j -= bch[b].size(), jstep = 1, trick = 0;
+    else jstep = -1, trick = 1;
+    int p = labelend[b];
+    while (j != 0) {
+      assign_label(endp(p ^ 1), 2, p, root);
+      j += jstep;
+      p = bendps[b][at(b, j - trick)] ^ trick;
+      j += jstep;
+    }
+    int bv = bch[b][at(b, j)]; // the base child, its mate is already S
+    labelend[bv] = p;
+    set_label(bv, 2, root);
+    // the other children are free
+    for (int c : bch[b]) if (label[c] == 0) freed.push_back(c);
+    labelend[b] = -1;
+    bch[b].clear();
+    bendps[b].clear();
+    bbase[b] = -1;
+    unused.push_back(b);
+  }
+  // swaps matched and unmatched edges on the even path from v to the base of b
+  void augment_blossom(int b, int v) {
+    int t = v;
+    while (bpar[t] != b) t = bpar[t];
+    if (t >= n) augment_blossom(t, v);
+    int i = find(bch[b].begin(), bch[b].end(), t) - bch[b].begin(), j = i, jstep, trick;
+    if (i & 1) j -= bch[b].size(), jstep = 1, trick = 0;
+    else jstep = -1, trick = 1;
+    while (j != 0) {
+      j += jstep;
+      t = bch[b][at(b, j)];
+      int p = bendps[b][at(b, j - trick)] ^ trick;
+      if (t >= n) augment_blossom(t, endp(p));
+      j += jstep;
+      t = bch[b][at(b, j)];
+      if (t >= n) augment_blossom(t, endp(p ^ 1));
+      mate[endp(p)] = p ^ 1;
+      mate[endp(p ^ 1)] = p;
+    }
+    rotate(bch[b].begin(), bch[b].begin() + i, bch[b].end());
+    rotate(bendps[b].begin(), bendps[b].begin() + i, bendps[b].end());
+    bbase[b] = bbase[bch[b][0]];
+  }
+  void augment_matching(int k) {
+    for (int side = 0; side < 2; side++) {
+      int s = side ? ev[k] : eu[k], p = side ? 2 * k : 2 * k + 1;
+      while (true) {
+        int bs = top(s);
+        if (bs >= n) augment_blossom(bs, s);
+        mate[s] = p;
+        if (labelend[bs] == -1) break;
+        int t = endp(labelend[bs]), bt = top(t);
+        s = endp(labelend[bt]);
+        int j = endp(labelend[bt] ^ 1);
+        if (bt >= n) augment_blossom(bt, j);
+        mate[j] = labelend[bt];
+        p = labelend[bt] ^ 1;
+      }
+    }
+  }
+  // augments along k and frees the top blossoms of the two trees it joins, the other trees stay
+  void augment(int k) {
+    int r[2] = {tree[top(eu[k])], tree[top(ev[k])]};
+    augment_matching(k);
+    for (int r0 : r) {
+      for (int b : tlist[r0]) if (alive(b) && bpar[b] == -1 && tree[b] == r0 && label[b]) {
+        relabel(b, 0);
+        freed.push_back(b);
+      }
+      tlist[r0].clear();
+    }
+  }
+  // returns the weight of the matching, match[v] is the mate of v or -1
+  T solve(bool max_cardinality = false) {
+    int m = eu.size();
+    st.assign(n + 1, 0);
+    for (int k = 0; k < m; k++) st[eu[k] + 1]++, st[ev[k] + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    nb.resize(2 * m);
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (int k = 0; k < m; k++) nb[pos[eu[k]]++] = 2 * k + 1, nb[pos[ev[k]]++] = 2 * k;
+    T mx = 0;
+    for (T w : ew) mx = max(mx, w);
+    mate.assign(n, -1);
+    label.assign(2 * n, 0);
+    labelend.assign(2 * n, -1);
+    bpar.assign(2 * n, -1);
+    bbase.assign(2 * n, -1);
+    iota(bbase.begin(), bbase.begin() + n, 0);
+    bsz.assign(2 * n, 1);
+    grp.resize(n), gtop.resize(n), gid.assign(2 * n, -1);
+    iota(grp.begin(), grp.end(), 0);
+    iota(gtop.begin(), gtop.end(), 0);
+    iota(gid.begin(), gid.begin() + n, 0);
+    gfree.clear();
+    off.assign(n, 0);
+    bch.assign(2 * n, {});
+    bendps.assign(2 * n, {});
+    tlist.assign(n, {});
+    tree.assign(2 * n, -1);
+    unused.clear();
+    for (int b = 2 * n - 1; b >= n; b--) unused.push_back(b);
+    dual.assign(2 * n, 0);
+    fill(dual.begin(), dual.begin() + n, mx);
+    G = 0, E = mx;
+    h2 = h3 = h4 = Q();
+    q.clear(), freed.clear(), z2.clear(), z3.clear();
+    // warm start: greedy matching on the tight edges (w = max weight), lowest degree first, every dual stays
+    // at max weight so the invariants hold (matched edges tight, all free vertices with the same dual)
+    vector<int> ord(n);
+    iota(ord.begin(), ord.end(), 0);
+    sort(ord.begin(), ord.end(), [&](int a, int b) {
+      return st[a + 1] - st[a] < st[b + 1] - st[b];
+    });
+    for (int v : ord) {
+      if (mate[v] != -1) continue;
+      for (int i = st[v]; i < st[v + 1]; i++) {
+        int p = nb[i], w = endp(p);
+        if (ew[p >> 1] == mx && mate[w] == -1) {
+          mate[v] = p, mate[w] = p ^ 1;
+          break;
+        }
+      }
+    }
+    int exposed = 0;
+    for (int v = 0; v < n; v++) if (mate[v] == -1) exposed++, set_label(v, 1, v);
+    vector<int> lv;
+    while (exposed > 1) {
+      while (!q.empty()) {
+        int b = q.back();
+        q.pop_back();
+        if (!alive(b)) continue;
+        lv.clear();
+        leaves(b, lv);
+        for (int v : lv) {
+          int bv = top(v);
+          if (label[bv] != 1) continue;
+          for (int i = st[v]; i < st[v + 1]; i++) {
+            int k = nb[i] >> 1, bw = top(endp(nb[i]));
+            if (bw == bv) continue;
+            if (label[bw] == 0) push2(k);
+            else if (label[bw] == 1) push3(k);
+          }
+        }
+      }
+      // the tight edges first, then the stale tops are dropped and the smallest delta is taken
+      int type = 0, k = -1;
+      while (!type && !z3.empty()) {
+        k = z3.back();
+        z3.pop_back();
+        if (ok3(k, 2 * G)) type = 3;
+      }
+      while (!type && !z2.empty()) {
+        k = z2.back();
+        z2.pop_back();
+        if (ok2(k, G)) type = 2;
+      }
+      if (!type) {
+        while (!h2.empty() && !ok2(h2.top().second, h2.top().first)) h2.pop();
+        while (!h3.empty() && !ok3(h3.top().second, h3.top().first)) h3.pop();
+        while (!h4.empty()) {
+          auto [x, b] = h4.top();
+          if (alive(b) && bpar[b] == -1 && label[b] == 2 && dual[b] == x) break;
+          h4.pop();
+        }
+        type = 1;
+        T delta = max_cardinality ? numeric_limits<T>::max() : E;
+        if (!h2.empty() && h2.top().first - G < delta) delta = h2.top().first - G, type = 2;
+        if (!h3.empty() && (h3.top().first - 2 * G) / 2 < delta) delta = (h3.top().first - 2 * G) / 2, type = 3;
+        if (!h4.empty() && h4.top().first - G < delta) delta = h4.top().first - G, type = 4;
+        // the freed vertices are only scanned before a delta > 0: the events at the current duals are used
+        // up first, so the augmentations of one dual level are found together like in a Hopcroft-Karp phase
+        if ((type == 1 || delta > 0) && !freed.empty()) {
+          for (int b : freed) if (alive(b)) {
+            lv.clear();
+            leaves(b, lv);
+            for (int x : lv) if (!label[top(x)]) scan_free(x);
+          }
+          freed.clear();
+          continue;
+        }
+        if (type == 1) break; // the free vertices reached 0 (or no augmenting path with max_cardinality)
+        Q &h = type == 2 ? h2 : type == 3 ? h3 : h4;
+        k = h.top().second;
+        h.pop();
+        G += delta, E -= delta;
+      }
+      if (type == 2) {
+        int f = label[top(eu[k])] ? ev[k] : eu[k], p = f == ev[k] ? 2 * k + 1 : 2 * k;
+        assign_label(f, 2, p ^ 1, tree[top(endp(p ^ 1))]);
+      } else if (type == 3) {
+        int base = scan_blossom(eu[k], ev[k]);
+        if (base >= 0) add_blossom(base, k);
+        else augment(k), exposed -= 2;
+      } else expand_blossom(k);
+    }
+    match.assign(n, -1);
+    T ans = 0;
+    for (int v = 0; v < n; v++) {
+      if (mate[v] == -1) continue;
+      match[v] = endp(mate[v]);
+      if (v < match[v]) ans += ew[mate[v] >> 1];
+    }
+    return ans;
+  }
+};
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m;
+  cin >> n >> m;
+  WeightedMatching M(n);
+  while (m--) {
+    int u, v, w;
+    cin >> u >> v >> w;
+    M.add_edge(u - 1, v - 1, w);
+  }
+  long long ans = M.solve();
+  cout << ans << '\n';
+  for (int i = 0; i < n; i++) cout << M.match[i] + 1 << ' ';
+  cout << '\n';
+}
+//http://uoj.ac/problem/81
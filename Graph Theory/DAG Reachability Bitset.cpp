@@ -0,0 +1,108 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Transitive closure of a DAG as one bitset row per node, n^2 / 8 bytes in total (50 MB for n = 2e4)
+is_reachable(s, t) is a single bit test
+Static: rows are filled in reverse topological order, row(v) = {v} | OR of row(u) for every edge v -> u,
+every OR handles 64 targets per word, the columns are split into word ranges that are
+completely independent, so each thread fills its own range for all the rows
+Complexity: O(n * m / 64 / threads)
+Dynamic: same semantics as Italiano, add_edge(s, t) inserts the edge if it doesn't make a cycle,
+then every ancestor p of s that doesn't reach t yet gets row(p) |= row(t)
+Complexity: O(n + (number of changed rows) * n / 64) per update
+0-indexed
+*/
+using ull = unsigned long long;
+struct Reachability {
+  int n, W;
+  vector<pair<int, int>> edges;
+  vector<ull> row;
+  Reachability() {}
+  Reachability(int _n): n(_n), W((_n + 63) / 64) {}
+  void add_edge(int u, int v) {
+    edges.emplace_back(u, v);
+  }
+  // returns false if the graph is not a DAG
+  bool build(int threads = 1) {
+    vector<int> st(n + 1, 0), adj(edges.size()), indeg(n, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, indeg[v]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (auto &[u, v] : edges) adj[pos[u]++] = v;
+    vector<int> topo;
+    topo.reserve(n);
+    for (int i = 0; i < n; i++) if (!indeg[i]) topo.push_back(i);
+    for (int i = 0; i < (int)topo.size(); i++) {
+      int u = topo[i];
+      for (int j = st[u]; j < st[u + 1]; j++) if (!--indeg[adj[j]]) topo.push_back(adj[j]);
+    }
+    if ((int)topo.size() != n) return false;
+    row.assign(1LL * n * W, 0);
+    threads = max(1, min(threads, W));
+    auto work = [&](int lo, int hi) {
+      for (int i = n - 1; i >= 0; i--) {
+        int v = topo[i];
+        ull *r = row.data() + 1LL * v * W;
+        if (lo <= (v >> 6) && (v >> 6) < hi) r[v >> 6] |= 1ULL << (v & 63);
+        for (int j = st[v]; j < st[v + 1]; j++) {
+          const ull *o = row.data() + 1LL * adj[j] * W;
+          for (int w = lo; w < hi; w++) r[w] |= o[w];
+        }
+      }
+    };
+    if (threads == 1) work(0, W);
+    else {
+      vector<thread> pool;
+      for (int t = 0; t < threads; t++) pool.emplace_back(work, 1LL * W * t / threads, 1LL * W * (t + 1) / threads);
+      for (auto &t : pool) t.join();
+    }
+    return true;
+  }
+  bool is_reachable(int s, int t) {
+    return row[1LL * s * W + (t >> 6)] >> (t & 63) & 1;
+  }
+};
+struct ReachabilityDynamic {
+  int n, W;
+  vector<ull> row;
+  ReachabilityDynamic() {}
+  ReachabilityDynamic(int _n): n(_n), W((_n + 63) / 64), row(1LL * _n * W, 0) {
+    for (int v = 0; v < n; v++) row[1LL * v * W + (v >> 6)] |= 1ULL << (v & 63);
+  }
+  bool is_reachable(int s, int t) {
+    return row[1LL * s * W + (t >> 6)] >> (t & 63) & 1;
+  }
+  bool add_edge(int s, int t) {
+    if (is_reachable(t, s)) return 0; // break DAG condition
+    if (is_reachable(s, t)) return 1; // no-modification performed
+    const ull *rt = row.data() + 1LL * t * W;
+    for (int p = 0; p < n; p++) {
+      if (is_reachable(p, s) && !is_reachable(p, t)) {
+        ull *rp = row.data() + 1LL * p * W;
+        for (int w = 0; w < W; w++) rp[w] |= rt[w];
+      }
+    }
+    return 1;
+  }
+};
+//add edges one by one. if it breaks DAG law then print it
+int32_t main() {
+  int n, m;
+  cin >> n >> m;
+  ReachabilityDynamic t(n);
+  while(m--) {
+    int u, v;
+    cin >> u >> v;
+    --u; --v;
+    if(t.is_reachable(v, u)) cout << u + 1 << ' ' << v + 1 << '\n';
+    else t.add_edge(u, v);
+  }
+  cout << 0 << ' ' << 0 << '\n';
+  return 0;
+}
+// https://www.spoj.com/problems/GHOSTS/
@@ -0,0 +1,215 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Dominator Tree with the Semi-NCA algorithm, everything iterative and sized at runtime
+semi(w) is computed like Lengauer-Tarjan with a path compressed forest (no balancing),
+then idom(w) = nearest common ancestor of parent(w) and semi(w) on the partially built dominator tree,
+found by walking up from parent(w) while the preorder number is larger than semi(w)
+Usually faster than Lengauer-Tarjan on control flow graphs as they have shallow dominator trees
+dominates(a, b) is O(1) with the pre/post order numbering of the dominator tree
+insert_edge(x, y) updates the tree without recomputing it (depth based search):
+a node w is affected iff depth(nca(x, y)) < depth(w) - 1 and there is a path from y to w
+where every node is at least as deep as w, all the affected nodes get idom = nca(x, y)
+Complexity: O(m log n) for build, insert_edge is O(n) for the renumbering plus the searched part
+0-indexed, idom[root] = -1 and idom[v] = -1 for the nodes not reachable from root
+*/
+struct DominatorTree {
+  int n, root;
+  vector<int> eu, ev;
+  vector<int> st, adj, rst, radj; // successors and predecessors in CSR
+  vector<int> head, nxt, to; // edges inserted after build
+  vector<int> idom, dep, tin, tout;
+  DominatorTree() {}
+  DominatorTree(int _n): n(_n) {}
+  void add_edge(int u, int v) {
+    eu.push_back(u);
+    ev.push_back(v);
+  }
+  void build_csr() {
+    st.assign(n + 1, 0);
+    rst.assign(n + 1, 0);
+    for (int i = 0; i < (int)eu.size(); i++) st[eu[i] + 1]++, rst[ev[i] + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i], rst[i + 1] += rst[i];
+    adj.resize(eu.size());
+    radj.resize(eu.size());
+    vector<int> p(st.begin(), st.end() - 1), q(rst.begin(), rst.end() - 1);
+    for (int i = 0; i < (int)eu.size(); i++) adj[p[eu[i]]++] = ev[i], radj[q[ev[i]]++] = eu[i];
+    head.assign(n, -1);
+    nxt.clear();
+    to.clear();
+  }
+  template<typename F>
+  void for_succ(int u, F f) {
+    for (int i = st[u]; i < st[u + 1]; i++) f(adj[i]);
+    for (int i = head[u]; i != -1; i = nxt[i]) f(to[i]);
+  }
+  void build(int _root) {
+    root = _root;
+    build_csr();
+    // preorder numbering
+    vector<int> id(n, -1), rev, par, it(st.begin(), st.end() - 1), stk = {root};
+    id[root] = 0;
+    rev.push_back(root);
+    par.push_back(-1);
+    while (!stk.empty()) {
+      int u = stk.back();
+      if (it[u] == st[u + 1]) {
+        stk.pop_back();
+        continue;
+      }
+      int v = adj[it[u]++];
+      if (id[v] != -1) continue;
+      id[v] = rev.size();
+      rev.push_back(v);
+      par.push_back(id[u]);
+      stk.push_back(v);
+    }
+    int k = rev.size();
+    vector<int> semi(k), label(k), anc(k, -1), dom(k), path;
+    iota(semi.begin(), semi.end(), 0);
+    iota(label.begin(), label.end(), 0);
+    auto eval = [&](int v) {
+      if (anc[v] == -1) return v;
+      path.clear();
+      for (int x = v; anc[x] != -1 && anc[anc[x]] != -1; x = anc[x]) path.push_back(x);
+      for (int i = (int)path.size() - 1; i >= 0; i--) {
+        int x = path[i], a = anc[x];
+        if (semi[label[a]] < semi[label[x]]) label[x] = label[a];
+        anc[x] = anc[a];
+      }
+      return label[v];
+    };
+    for (int w = k - 1; w > 0; w--) {
+      int u = rev[w];
+      for (int i = rst[u]; i < rst[u + 1]; i++) {
+        int v = id[radj[i]];
+        if (v == -1) continue;
+        semi[w] = min(semi[w], semi[eval(v)]);
+      }
+      anc[w] = par[w];
+    }
+    dom[0] = 0;
+    for (int w = 1; w < k; w++) {
+      int x = par[w];
+      while (x > semi[w]) x = dom[x];
+      dom[w] = x;
+    }
+    idom.assign(n, -1);
+    for (int w = 1; w < k; w++) idom[rev[w]] = rev[dom[w]];
+    renumber();
+  }
+  // depth, pre and post order numbers of the dominator tree
+  void renumber() {
+    vector<int> cst(n + 1, 0), ch(n);
+    for (int v = 0; v < n; v++) if (idom[v] != -1) cst[idom[v] + 1]++;
+    for (int i = 0; i < n; i++) cst[i + 1] += cst[i];
+    vector<int> p(cst.begin(), cst.end() - 1);
+    for (int v = 0; v < n; v++) if (idom[v] != -1) ch[p[idom[v]]++] = v;
+    dep.assign(n, -1);
+    tin.assign(n, -1);
+    tout.assign(n, -1);
+    int timer = 0;
+    vector<int> stk = {root}, it(cst.begin(), cst.end() - 1);
+    dep[root] = 0;
+    tin[root] = timer++;
+    while (!stk.empty()) {
+      int u = stk.back();
+      if (it[u] == cst[u + 1]) {
+        tout[u] = timer;
+        stk.pop_back();
+        continue;
+      }
+      int v = ch[it[u]++];
+      dep[v] = dep[u] + 1;
+      tin[v] = timer++;
+      stk.push_back(v);
+    }
+  }
+  bool reachable(int v) {
+    return tin[v] != -1;
+  }
+  // does a dominate b
+  bool dominates(int a, int b) {
+    if (!reachable(a) || !reachable(b)) return false;
+    return tin[a] <= tin[b] && tout[b] <= tout[a];
+  }
+  vector<bool> dominates_batch(const vector<pair<int, int>> &qs) {
+    vector<bool> ans(qs.size());
+    for (int i = 0; i < (int)qs.size(); i++) ans[i] = dominates(qs[i].first, qs[i].second);
+    return ans;
+  }
+  int nca(int u, int v) {
+    while (u != v) {
+      if (dep[u] < dep[v]) swap(u, v);
+      u = idom[u];
+    }
+    return u;
+  }
+  void insert_edge(int x, int y) {
+    to.push_back(y);
+    nxt.push_back(head[x]);
+    head[x] = to.size() - 1;
+    eu.push_back(x);
+    ev.push_back(y);
+    if (!reachable(x)) return;
+    if (!reachable(y)) { // new nodes become reachable
+      build(root);
+      return;
+    }
+    int z = nca(x, y);
+    if (z == y || z == idom[y]) return;
+    int lim = dep[z] + 1;
+    // b[v] = max over paths from y to v of the minimum depth on the path
+    unordered_map<int, int> b;
+    priority_queue<pair<int, int>> pq;
+    vector<int> affected;
+    b[y] = dep[y];
+    pq.push({dep[y], y});
+    while (!pq.empty()) {
+      auto [bv, v] = pq.top();
+      pq.pop();
+      if (b[v] != bv) continue;
+      if (bv == dep[v]) affected.push_back(v);
+      for_succ(v, [&](int u) {
+        if (!reachable(u)) return;
+        int nb = min(bv, dep[u]);
+        if (nb <= lim) return;
+        auto itb = b.find(u);
+        if (itb == b.end() || itb->second < nb) {
+          b[u] = nb;
+          pq.push({nb, u});
+        }
+      });
+    }
+    for (int w : affected) idom[w] = z;
+    renumber();
+  }
+};
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+
+  int n, m;
+  while(cin >> n >> m) {
+    DominatorTree D(n + 1);
+    vector<pair<int, int>> ed;
+    for(int i = 0; i < m; i++) {
+      int u, v;
+      cin >> u >> v;
+      D.add_edge(u, v);
+      ed.push_back({u, v});
+    }
+    D.build(1);
+    vector<int> ans;
+    for(int i = 0; i < m; i++) {
+      int u = ed[i].first, v = ed[i].second;
+      if(D.reachable(u) && !D.dominates(v, u)) ans.push_back(i);
+    }
+    cout << ans.size() << '\n';
+    for(auto x: ans) cout << x + 1 << ' ';
+    cout << '\n';
+  }
+  return 0;
+}
+//https://codeforces.com/gym/100513/problem/L
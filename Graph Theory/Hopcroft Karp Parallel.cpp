@@ -0,0 +1,213 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Bipartite matching engine for big graphs, sized at runtime, adjacency in CSR (4 bytes per edge)
+Initial matching: Karp-Sipser, a vertex with only one free neighbour is matched to it first,
+otherwise an arbitrary free edge is taken, usually only a few vertices are left to Hopcroft-Karp
+Hopcroft-Karp: the bfs layers are built frontier by frontier, a big frontier is split between threads
+and a left node is claimed with a compare and swap on its layer, the augmenting dfs is iterative
+with a current arc pointer per node, so no stack overflow at 2e6 nodes
+Updates: insert_edge / erase_edge are collected and applied when maximum_matching() is called again,
+the CSR is rebuilt and the old matching (without the erased edges) is the warm start, after k updates
+at most k augmentations are needed
+Complexity: O(m sqrt(n)) for the matching, O(n + m) to apply a batch of updates
+0-indexed, left nodes in [0, nl), right nodes in [0, nr), l[u] / r[v] = mate or -1
+*/
+struct BipartiteMatching {
+  static constexpr int inf = INT_MAX;
+  int nl, nr, threads;
+  vector<long long> st;
+  vector<int> adj;
+  vector<pair<int, int>> ins, ers; // pending updates
+  vector<int> l, r, dist;
+  vector<long long> it;
+  bool built = false;
+  BipartiteMatching() {}
+  BipartiteMatching(int _nl, int _nr, int _threads = 1): nl(_nl), nr(_nr), threads(max(1, _threads)),
+    st(_nl + 1, 0), l(_nl, -1), r(_nr, -1) {}
+  void reserve(long long m) {
+    ins.reserve(m);
+  }
+  void add_edge(int u, int v) {
+    ins.emplace_back(u, v);
+  }
+  void insert_edge(int u, int v) {
+    ins.emplace_back(u, v);
+  }
+  // removes every copy of the edge (u, v)
+  void erase_edge(int u, int v) {
+    ins.erase(remove(ins.begin(), ins.end(), make_pair(u, v)), ins.end());
+    ers.emplace_back(u, v);
+    if (l[u] == v) l[u] = -1, r[v] = -1;
+  }
+  void rebuild() {
+    sort(ers.begin(), ers.end());
+    auto erased = [&](int u, int v) {
+      return binary_search(ers.begin(), ers.end(), make_pair(u, v));
+    };
+    vector<long long> nst(nl + 1, 0);
+    for (int u = 0; u < nl; u++) {
+      for (long long i = st[u]; i < st[u + 1]; i++) if (ers.empty() || !erased(u, adj[i])) nst[u + 1]++;
+    }
+    for (auto &[u, v] : ins) nst[u + 1]++;
+    for (int u = 0; u < nl; u++) nst[u + 1] += nst[u];
+    vector<int> nadj(nst[nl]);
+    vector<long long> pos(nst.begin(), nst.end() - 1);
+    for (int u = 0; u < nl; u++) {
+      for (long long i = st[u]; i < st[u + 1]; i++) if (ers.empty() || !erased(u, adj[i])) nadj[pos[u]++] = adj[i];
+    }
+    for (auto &[u, v] : ins) nadj[pos[u]++] = v;
+    st.swap(nst);
+    adj.swap(nadj);
+    ins.clear();
+    ins.shrink_to_fit();
+    ers.clear();
+  }
+  void karp_sipser() {
+    vector<long long> rst(nr + 1, 0);
+    for (int v : adj) rst[v + 1]++;
+    for (int v = 0; v < nr; v++) rst[v + 1] += rst[v];
+    vector<int> radj(adj.size());
+    vector<long long> pos(rst.begin(), rst.end() - 1);
+    for (int u = 0; u < nl; u++) for (long long i = st[u]; i < st[u + 1]; i++) radj[pos[adj[i]]++] = u;
+    // degree = number of edges to free nodes, right nodes are shifted by nl in the stack
+    vector<int> deg(nl + nr), stk;
+    for (int u = 0; u < nl; u++) deg[u] = st[u + 1] - st[u];
+    for (int v = 0; v < nr; v++) deg[nl + v] = rst[v + 1] - rst[v];
+    for (int x = 0; x < nl + nr; x++) if (deg[x] == 1) stk.push_back(x);
+    auto match = [&](int u, int v) {
+      l[u] = v, r[v] = u;
+      for (long long i = rst[v]; i < rst[v + 1]; i++) {
+        int w = radj[i];
+        if (l[w] == -1 && --deg[w] == 1) stk.push_back(w);
+      }
+      for (long long i = st[u]; i < st[u + 1]; i++) {
+        int x = adj[i];
+        if (r[x] == -1 && --deg[nl + x] == 1) stk.push_back(nl + x);
+      }
+    };
+    auto drain = [&]() {
+      while (!stk.empty()) {
+        int x = stk.back();
+        stk.pop_back();
+        if (x < nl) {
+          if (l[x] != -1) continue;
+          for (long long i = st[x]; i < st[x + 1]; i++) if (r[adj[i]] == -1) {
+            match(x, adj[i]);
+            break;
+          }
+        } else {
+          int v = x - nl;
+          if (r[v] != -1) continue;
+          for (long long i = rst[v]; i < rst[v + 1]; i++) if (l[radj[i]] == -1) {
+            match(radj[i], v);
+            break;
+          }
+        }
+      }
+    };
+    drain();
+    for (int u = 0; u < nl; u++) {
+      if (l[u] != -1) continue;
+      for (long long i = st[u]; i < st[u + 1]; i++) if (r[adj[i]] == -1) {
+        match(u, adj[i]);
+        break;
+      }
+      drain();
+    }
+  }
+  // layers from all the free left nodes, returns the layer where a free right node shows up, -1 if none
+  int bfs() {
+    vector<int> cur, nxt;
+    for (int u = 0; u < nl; u++) {
+      if (l[u] == -1) dist[u] = 0, cur.push_back(u);
+      else dist[u] = inf;
+    }
+    for (int d = 0; !cur.empty(); d++) {
+      atomic<bool> found(false);
+      auto expand = [&](int lo, int hi, vector<int> &out) {
+        bool f = false;
+        for (int i = lo; i < hi; i++) {
+          int u = cur[i];
+          for (long long j = st[u]; j < st[u + 1]; j++) {
+            int w = r[adj[j]];
+            if (w == -1) f = true;
+            else if (__atomic_load_n(&dist[w], __ATOMIC_RELAXED) == inf && __sync_bool_compare_and_swap(&dist[w], inf, d + 1)) out.push_back(w);
+          }
+        }
+        if (f) found = true;
+      };
+      nxt.clear();
+      int k = cur.size(), th = k < 4096 ? 1 : threads;
+      if (th == 1) expand(0, k, nxt);
+      else {
+        vector<vector<int>> part(th);
+        vector<thread> pool;
+        for (int t = 0; t < th; t++) pool.emplace_back(expand, 1LL * k * t / th, 1LL * k * (t + 1) / th, ref(part[t]));
+        for (auto &t : pool) t.join();
+        for (auto &p : part) nxt.insert(nxt.end(), p.begin(), p.end());
+      }
+      if (found) return d;
+      cur.swap(nxt);
+    }
+    return -1;
+  }
+  bool dfs(int s, int lim, vector<int> &stk) {
+    stk.assign(1, s);
+    while (!stk.empty()) {
+      int u = stk.back();
+      if (it[u] == st[u + 1]) {
+        dist[u] = inf;
+        stk.pop_back();
+        continue;
+      }
+      int v = adj[it[u]], w = r[v];
+      if (w == -1 ? dist[u] == lim : dist[w] == dist[u] + 1) {
+        if (w == -1) {
+          for (int x : stk) {
+            int y = adj[it[x]];
+            l[x] = y, r[y] = x;
+          }
+          return true;
+        }
+        stk.push_back(w);
+      } else it[u]++;
+    }
+    return false;
+  }
+  int maximum_matching() {
+    if (!built) {
+      rebuild();
+      karp_sipser();
+      built = true;
+    } else if (!ins.empty() || !ers.empty()) rebuild();
+    dist.assign(nl, inf);
+    it.resize(nl);
+    vector<int> stk;
+    for (int lim; (lim = bfs()) != -1; ) {
+      for (int u = 0; u < nl; u++) it[u] = st[u];
+      for (int u = 0; u < nl; u++) if (l[u] == -1) dfs(u, lim, stk);
+    }
+    int ans = 0;
+    for (int u = 0; u < nl; u++) ans += l[u] != -1;
+    return ans;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m, q;
+  cin >> n >> m >> q;
+  BipartiteMatching M(n, m, thread::hardware_concurrency());
+  M.reserve(q);
+  while (q--) {
+    int u, v;
+    cin >> u >> v;
+    M.add_edge(u, v);
+  }
+  cout << M.maximum_matching() << '\n';
+  for (int u = 0; u < n; u++) if (M.l[u] != -1) cout << u << ' ' << M.l[u] << '\n';
+  return 0;
+}
+// https://judge.yosupo.jp/problem/bipartitematching
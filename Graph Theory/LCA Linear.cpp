@@ -0,0 +1,193 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+LCA with O(n) preprocessing and O(1) query, no recursion and no log n table per node
+Iterative dfs over a CSR adjacency gives the preorder, the postorder, parent and depth
+If tin[u] < tin[v] then lca(u, v) = parent of the shallowest node among preorder positions (tin[u], tin[v]],
+so the RMQ is over n values instead of the 2n Euler tour
+RMQ: blocks of 64, sparse table over the block minimums and inside a block a 64-bit mask per position
+that keeps the monotonic stack, so an in-block query is one ctz
+lca_batch: offline Tarjan with a DSU in dfs postorder when all the queries are known up front
+level_ancestor: the nodes of every depth sorted by tin, binary search in O(log n) with O(n) memory
+Memory: the edge list and the CSR are only needed by build() and are freed at its end (add the edges again
+to rebuild), what stays is par, dep, tin, order, post, lvl (4 bytes each) and mask (8 bytes), 33 bytes per
+node (+4 for lvl_st on a path), the peak inside build() is ~61 bytes per node (random tree of 5e6 nodes)
+0-indexed
+*/
+struct LCA {
+  int n, root;
+  vector<pair<int, int>> edges;
+  vector<int> st, adj, par, dep, tin, order, post;
+  vector<int> lvl_st, lvl; // nodes grouped by depth in preorder
+  vector<unsigned long long> mask;
+  vector<vector<int>> sp;
+  LCA() {}
+  LCA(int _n): n(_n) {}
+  void add_edge(int u, int v) {
+    edges.emplace_back(u, v);
+  }
+  // position of the shallower node
+  inline int better(int i, int j) {
+    return dep[order[i]] <= dep[order[j]] ? i : j;
+  }
+  void build(int _root = 0) {
+    root = _root;
+    st.assign(n + 1, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, st[v + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    adj.resize(st[n]);
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (auto &[u, v] : edges) adj[pos[u]++] = v, adj[pos[v]++] = u;
+    par.assign(n, -1);
+    dep.assign(n, 0);
+    tin.assign(n, -1);
+    order.clear();
+    post.clear();
+    order.reserve(n);
+    post.reserve(n);
+    vector<int> stk = {root}, it(st.begin(), st.end() - 1);
+    tin[root] = 0;
+    order.push_back(root);
+    while (!stk.empty()) {
+      int u = stk.back();
+      if (it[u] == st[u + 1]) {
+        post.push_back(u);
+        stk.pop_back();
+        continue;
+      }
+      int v = adj[it[u]++];
+      if (v == par[u]) continue;
+      par[v] = u;
+      dep[v] = dep[u] + 1;
+      tin[v] = order.size();
+      order.push_back(v);
+      stk.push_back(v);
+    }
+    int m = order.size(); // only the component of the root
+    mask.assign(m, 0);
+    int nb = (m + 63) >> 6;
+    vector<int> stack_;
+    vector<int> bmin(nb);
+    for (int b = 0; b < nb; b++) {
+      int l = b << 6, r = min(m, l + 64);
+      unsigned long long cur = 0;
+      stack_.clear();
+      for (int i = l; i < r; i++) {
+        while (!stack_.empty() && dep[order[stack_.back()]] > dep[order[i]]) {
+          cur &= ~(1ULL << (stack_.back() - l));
+          stack_.pop_back();
+        }
+        stack_.push_back(i);
+        cur |= 1ULL << (i - l);
+        mask[i] = cur;
+      }
+      bmin[b] = l + __builtin_ctzll(mask[r - 1]);
+    }
+    int lg = 1;
+    while ((1 << lg) <= nb) lg++;
+    sp.assign(lg, bmin);
+    for (int k = 1; k < lg; k++) {
+      for (int b = 0; b + (1 << k) <= nb; b++) sp[k][b] = better(sp[k - 1][b], sp[k - 1][b + (1 << (k - 1))]);
+    }
+    int mx = 0;
+    for (int v : order) mx = max(mx, dep[v]);
+    lvl_st.assign(mx + 2, 0);
+    for (int v : order) lvl_st[dep[v] + 1]++;
+    for (int d = 0; d <= mx; d++) lvl_st[d + 1] += lvl_st[d];
+    lvl.resize(m);
+    vector<int> lp(lvl_st.begin(), lvl_st.end() - 1);
+    for (int v : order) lvl[lp[dep[v]]++] = v;
+    vector<pair<int, int>>().swap(edges);
+    vector<int>().swap(st);
+    vector<int>().swap(adj);
+  }
+  // position of the shallowest node in preorder positions [l, r]
+  int query(int l, int r) {
+    int bl = l >> 6, br = r >> 6;
+    if (bl == br) return l + __builtin_ctzll(mask[r] >> (l & 63));
+    int ans = better(l + __builtin_ctzll(mask[(bl << 6) + 63] >> (l & 63)), (br << 6) + __builtin_ctzll(mask[r]));
+    if (bl + 1 < br) {
+      int k = __lg(br - bl - 1);
+      ans = better(ans, better(sp[k][bl + 1], sp[k][br - (1 << k)]));
+    }
+    return ans;
+  }
+  int lca(int u, int v) {
+    if (u == v) return u;
+    if (tin[u] > tin[v]) swap(u, v);
+    return par[order[query(tin[u] + 1, tin[v])]];
+  }
+  int dist(int u, int v) {
+    return dep[u] + dep[v] - 2 * dep[lca(u, v)];
+  }
+  // ancestor of u which is k levels above, -1 if it doesn't exist
+  int level_ancestor(int u, int k) {
+    int d = dep[u] - k;
+    if (k < 0 || d < 0) return -1;
+    // last node of depth d with tin <= tin[u]
+    int lo = lvl_st[d], hi = lvl_st[d + 1] - 1;
+    while (lo < hi) {
+      int mid = (lo + hi + 1) >> 1;
+      if (tin[lvl[mid]] <= tin[u]) lo = mid;
+      else hi = mid - 1;
+    }
+    return lvl[lo];
+  }
+  //kth node from u to v, 0th node is u
+  int go(int u, int v, int k) {
+    int l = lca(u, v);
+    int d = dep[u] + dep[v] - (dep[l] << 1);
+    assert(k <= d);
+    if (dep[l] + k <= dep[u]) return level_ancestor(u, k);
+    k -= dep[u] - dep[l];
+    return level_ancestor(v, dep[v] - dep[l] - k);
+  }
+  // offline Tarjan, when a node finishes its set is linked to its parent
+  // so find(w) is the lowest unfinished ancestor of w
+  vector<int> lca_batch(const vector<pair<int, int>> &qs) {
+    int q = qs.size();
+    vector<int> qst(n + 1, 0), qid(2 * q), ans(q, -1);
+    for (auto &[u, v] : qs) qst[u + 1]++, qst[v + 1]++;
+    for (int i = 0; i < n; i++) qst[i + 1] += qst[i];
+    vector<int> qp(qst.begin(), qst.end() - 1);
+    for (int i = 0; i < q; i++) qid[qp[qs[i].first]++] = i, qid[qp[qs[i].second]++] = i;
+    vector<int> dsu(n), done(n, 0);
+    iota(dsu.begin(), dsu.end(), 0);
+    auto find = [&](int x) {
+      while (dsu[x] != x) x = dsu[x] = dsu[dsu[x]];
+      return x;
+    };
+    for (int u : post) {
+      done[u] = 1;
+      for (int i = qst[u]; i < qst[u + 1]; i++) {
+        int id = qid[i], w = qs[id].first ^ qs[id].second ^ u;
+        if (done[w]) ans[id] = find(w);
+      }
+      if (par[u] != -1) dsu[u] = par[u];
+    }
+    return ans;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, q;
+  cin >> n >> q;
+  LCA L(n);
+  for (int i = 1; i < n; i++) {
+    int p;
+    cin >> p;
+    L.add_edge(p, i);
+  }
+  L.build(0);
+  vector<pair<int, int>> qs(q);
+  for (auto &[u, v] : qs) cin >> u >> v;
+  auto ans = L.lca_batch(qs);
+  for (int i = 0; i < q; i++) {
+    assert(ans[i] == L.lca(qs[i].first, qs[i].second));
+    cout << ans[i] << '\n';
+  }
+  return 0;
+}
+// https://judge.yosupo.jp/problem/lca
@@ -0,0 +1,198 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Manhattan MST (and Chebyshev MST) for millions of points, sized at runtime
+Candidates: for each of the 4 octant pairs the points are swept in (x, y) order with a Fenwick tree over
+the ranks of y - x that keeps the point with the smallest x + y, every point gets at most one candidate
+per sweep, so at most 4n edges, and the MST is inside them
+The 4 sweeps are independent and run in their own threads, all the orders (by x then y, ranks of y - x)
+come from LSD radix sorts with 16 bit digits, a digit that is the same for every key is skipped
+MST: the candidates are radix sorted by weight once, then Boruvka: the alive edges stay in that order so the
+lightest edge of a component is the one with the smallest position (no ties, so no cycles), every round it is
+found with a compare and swap min over the edges split between threads, then the components are merged and
+renumbered and the edges are relabeled, the ones inside a component are dropped
+Every MST edge is handed to the callback as soon as it is found, nothing else is stored
+Chebyshev: max(|dx|, |dy|) = (|du| + |dv|) / 2 with u = x + y, v = x - y, so it is the same MST
+Complexity: O(n log n) for the sweeps (the Fenwick trees), O(n log n) for Boruvka, memory O(n)
+0-indexed
+*/
+struct ManhattanMST {
+  using ull = unsigned long long;
+  int n, threads;
+  bool cheb;
+  vector<long long> X, Y;
+  ManhattanMST(int _threads = 1, bool chebyshev = false): n(0), threads(max(1, _threads)), cheb(chebyshev) {}
+  void add_point(long long x, long long y) {
+    if (cheb) X.push_back(x + y), Y.push_back(x - y);
+    else X.push_back(x), Y.push_back(y);
+    n++;
+  }
+  template<typename F>
+  void parallel_for(int cnt, F f) {
+    if (threads == 1 || cnt == 1) {
+      for (int i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<int> nxt(0);
+    vector<thread> pool;
+    for (int t = 0; t < min(threads, cnt); t++) {
+      pool.emplace_back([&]() {
+        for (int i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+  static ull key(long long v) {
+    return (ull)v ^ (1ULL << 63);
+  }
+  // stable sort by key
+  static void radix_sort(vector<pair<ull, int>> &a, vector<pair<ull, int>> &tmp) {
+    ull o = 0, an = ~0ULL;
+    for (auto &x : a) o |= x.first, an &= x.first;
+    tmp.resize(a.size());
+    vector<int> c(1 << 16 | 1);
+    for (int sh = 0; sh < 64; sh += 16) {
+      if (!((o ^ an) >> sh & 65535)) continue;
+      fill(c.begin(), c.end(), 0);
+      for (auto &x : a) c[(x.first >> sh & 65535) + 1]++;
+      for (int i = 0; i < 1 << 16; i++) c[i + 1] += c[i];
+      for (auto &x : a) tmp[c[x.first >> sh & 65535]++] = x;
+      a.swap(tmp);
+    }
+  }
+  long long weight(int i, int j) {
+    long long w = llabs(X[i] - X[j]) + llabs(Y[i] - Y[j]);
+    return cheb ? w / 2 : w;
+  }
+  // the points are seen as (x, y), (y, x), (-y, x), (x, -y)
+  void sweep(int d, vector<pair<int, int>> &out) {
+    auto px = [&](int i) {
+      return d == 0 || d == 3 ? X[i] : d == 1 ? Y[i] : -Y[i];
+    };
+    auto py = [&](int i) {
+      return d == 0 ? Y[i] : d == 3 ? -Y[i] : X[i];
+    };
+    vector<pair<ull, int>> a(n), tmp;
+    for (int i = 0; i < n; i++) a[i] = {key(py(i)), i};
+    radix_sort(a, tmp);
+    for (auto &x : a) x.first = key(px(x.second));
+    radix_sort(a, tmp);
+    vector<int> ord(n), rk(n);
+    for (int j = 0; j < n; j++) ord[j] = a[j].second;
+    for (int j = 0; j < n; j++) a[j] = {key(py(ord[j]) - px(ord[j])), j};
+    radix_sort(a, tmp);
+    int K = 0;
+    for (int j = 0; j < n; j++) {
+      if (!j || a[j].first != a[j - 1].first) K++;
+      rk[a[j].second] = K;
+    }
+    vector<pair<ull, int>>().swap(a);
+    vector<pair<ull, int>>().swap(tmp);
+    // suffix minimum of x + y over the ranks
+    vector<pair<long long, int>> t(K + 1, {LLONG_MAX, -1});
+    for (int j = n - 1; j >= 0; j--) {
+      int i = ord[j], best = -1;
+      long long r = LLONG_MAX;
+      for (int x = rk[j]; x <= K; x += x & -x) if (t[x].first < r) r = t[x].first, best = t[x].second;
+      if (best != -1) out.emplace_back(i, best);
+      long long w = px(i) + py(i);
+      for (int x = rk[j]; x > 0; x -= x & -x) if (t[x].first > w) t[x] = {w, i};
+    }
+  }
+  // calls f(u, v, w) for every edge of the MST, returns the total weight
+  template<typename F>
+  long long solve(F f) {
+    if (n <= 1) return 0;
+    vector<pair<int, int>> cand[4];
+    if (threads >= 4) {
+      vector<thread> pool;
+      for (int d = 0; d < 4; d++) pool.emplace_back([&, d]() {
+        sweep(d, cand[d]);
+      });
+      for (auto &t : pool) t.join();
+    } else for (int d = 0; d < 4; d++) sweep(d, cand[d]);
+    // candidates sorted by weight, the position is the tie break, so the lightest edge is the first one
+    vector<pair<ull, int>> a, tmp;
+    vector<int> U, V;
+    size_t tot = 0;
+    for (int d = 0; d < 4; d++) tot += cand[d].size();
+    a.reserve(tot), U.reserve(tot), V.reserve(tot);
+    for (int d = 0; d < 4; d++) {
+      for (auto &[u, v] : cand[d]) a.push_back({(ull)weight(u, v), (int)U.size()}), U.push_back(u), V.push_back(v);
+      vector<pair<int, int>>().swap(cand[d]);
+    }
+    radix_sort(a, tmp);
+    vector<pair<ull, int>>().swap(tmp);
+    int m = a.size();
+    // alive edges in sorted order with the current component of their endpoints
+    vector<int> eid(m), cu(m), cv(m), best, par;
+    for (int j = 0; j < m; j++) eid[j] = j, cu[j] = U[a[j].second], cv[j] = V[a[j].second];
+    const int CH = 1 << 16;
+    long long total = 0;
+    int c = n;
+    while (c > 1 && !eid.empty()) {
+      best.assign(c, INT_MAX);
+      int k = eid.size(), chunks = (k + CH - 1) / CH;
+      parallel_for(chunks, [&](int b) {
+        for (int j = b * CH; j < min(k, (b + 1) * CH); j++) {
+          for (int x : {cu[j], cv[j]}) {
+            int cur = __atomic_load_n(&best[x], __ATOMIC_RELAXED);
+            while (j < cur && !__atomic_compare_exchange_n(&best[x], &cur, j, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+          }
+        }
+      });
+      par.resize(c);
+      iota(par.begin(), par.end(), 0);
+      auto find = [&](int x) {
+        while (par[x] != x) x = par[x] = par[par[x]];
+        return x;
+      };
+      for (int x = 0; x < c; x++) {
+        int j = best[x];
+        if (j == INT_MAX) continue;
+        int e = eid[j], p = find(cu[j]), q = find(cv[j]);
+        if (p == q) continue;
+        par[p] = q;
+        total += a[e].first;
+        f(U[a[e].second], V[a[e].second], (long long)a[e].first);
+      }
+      vector<int> nid(c, -1);
+      int nc = 0;
+      for (int x = 0; x < c; x++) if (find(x) == x) nid[x] = nc++;
+      for (int x = 0; x < c; x++) nid[x] = nid[find(x)];
+      vector<vector<int>> keep(chunks);
+      parallel_for(chunks, [&](int b) {
+        for (int j = b * CH; j < min(k, (b + 1) * CH); j++) {
+          int p = nid[cu[j]], q = nid[cv[j]];
+          if (p != q) keep[b].push_back(j);
+        }
+      });
+      vector<int> neid, ncu, ncv;
+      for (auto &ch : keep) for (int j : ch) neid.push_back(eid[j]), ncu.push_back(nid[cu[j]]), ncv.push_back(nid[cv[j]]);
+      eid.swap(neid), cu.swap(ncu), cv.swap(ncv);
+      c = nc;
+    }
+    return total;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n;
+  cin >> n;
+  ManhattanMST M(thread::hardware_concurrency());
+  for (int i = 0; i < n; i++) {
+    long long x, y;
+    cin >> x >> y;
+    M.add_point(x, y);
+  }
+  vector<pair<int, int>> es;
+  long long ans = M.solve([&](int u, int v, long long) {
+    es.emplace_back(u, v);
+  });
+  cout << ans << '\n';
+  for (auto &[u, v] : es) cout << u << ' ' << v << '\n';
+  return 0;
+}
+// https://judge.yosupo.jp/problem/manhattanmst
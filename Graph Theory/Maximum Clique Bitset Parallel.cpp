@@ -0,0 +1,203 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+BBMC maximum clique with runtime n
+Vertices are renumbered by non-increasing degree and every candidate set is a bitset of 64-bit words
+Bound: greedy sequential coloring of the candidate set done word by word,
+a vertex with color k can't extend the current clique beyond |C| + k
+The branches of the root are spread over threads, each thread owns a deque of them and steals
+from the others when it runs out, the best size found so far is shared through an atomic
+Maximum independent set is the maximum clique of the complement graph
+Exponential in the worst case, n = 1000 with density 0.1 and n = 200 with density 0.5 are fast
+0-indexed
+*/
+using ull = unsigned long long;
+struct MaxClique {
+  int n, W;
+  vector<vector<ull>> g, adj; // adj is g after renumbering
+  vector<int> id; // new index -> original vertex
+  atomic<int> best;
+  mutex mtx;
+  vector<int> ans;
+  MaxClique() {}
+  MaxClique(int _n) {
+    n = _n;
+    W = (n + 63) / 64;
+    g.assign(n, vector<ull>(W, 0));
+  }
+  void add_edge(int u, int v) {
+    if (u == v) return;
+    g[u][v >> 6] |= 1ULL << (v & 63);
+    g[v][u >> 6] |= 1ULL << (u & 63);
+  }
+  struct Worker {
+    MaxClique *M;
+    vector<int> cur;
+    vector<vector<ull>> P, U, Q;
+    vector<vector<int>> vs, cs;
+    Worker(MaxClique *_M): M(_M) {}
+    void reserve(int lev) {
+      while ((int)P.size() <= lev) {
+        P.emplace_back(M->W);
+        U.emplace_back(M->W);
+        Q.emplace_back(M->W);
+        vs.emplace_back();
+        cs.emplace_back();
+      }
+    }
+    // sequential coloring of P, only vertices with color >= kmin are kept as branching candidates
+    void color(int lev, int kmin) {
+      int W = M->W;
+      vector<ull> &u = U[lev], &q = Q[lev];
+      u = P[lev];
+      vs[lev].clear();
+      cs[lev].clear();
+      int left = 0;
+      for (int w = 0; w < W; w++) left += __builtin_popcountll(u[w]);
+      for (int k = 1; left; k++) {
+        q = u;
+        for (int w = 0; w < W; w++) {
+          while (q[w]) {
+            int v = w * 64 + __builtin_ctzll(q[w]);
+            q[w] &= q[w] - 1;
+            u[w] &= ~(1ULL << (v & 63));
+            left--;
+            const vector<ull> &a = M->adj[v];
+            for (int x = w; x < W; x++) q[x] &= ~a[x];
+            if (k >= kmin) {
+              vs[lev].push_back(v);
+              cs[lev].push_back(k);
+            }
+          }
+        }
+      }
+    }
+    void update() {
+      if ((int)cur.size() <= M->best.load()) return;
+      lock_guard<mutex> lock(M->mtx);
+      if ((int)cur.size() > M->best.load()) {
+        M->best = cur.size();
+        M->ans.clear();
+        for (int v : cur) M->ans.push_back(M->id[v]);
+      }
+    }
+    // try v as the next vertex, the candidates are P[lev - 1] & adj[v]
+    void branch(int lev, int v) {
+      reserve(lev);
+      cur.push_back(v);
+      const vector<ull> &a = M->adj[v], &p = P[lev - 1];
+      vector<ull> &np = P[lev];
+      bool any = false;
+      for (int w = 0; w < M->W; w++) {
+        np[w] = p[w] & a[w];
+        any |= np[w] != 0;
+      }
+      if (any) expand(lev);
+      else update();
+      cur.pop_back();
+    }
+    void expand(int lev) {
+      color(lev, max(1, M->best.load() - (int)cur.size() + 1));
+      for (int i = (int)vs[lev].size() - 1; i >= 0; i--) {
+        if ((int)cur.size() + cs[lev][i] <= M->best.load()) return;
+        int v = vs[lev][i];
+        branch(lev + 1, v);
+        P[lev][v >> 6] &= ~(1ULL << (v & 63));
+      }
+    }
+  };
+  vector<int> solve(int threads = 1) { // returns the clique
+    threads = max(1, threads);
+    vector<int> deg(n, 0);
+    for (int i = 0; i < n; i++) for (int w = 0; w < W; w++) deg[i] += __builtin_popcountll(g[i][w]);
+    id.resize(n);
+    iota(id.begin(), id.end(), 0);
+    stable_sort(id.begin(), id.end(), [&](int a, int b) {
+      return deg[a] > deg[b];
+    });
+    vector<int> pos(n);
+    for (int i = 0; i < n; i++) pos[id[i]] = i;
+    adj.assign(n, vector<ull>(W, 0));
+    for (int i = 0; i < n; i++) {
+      for (int w = 0; w < W; w++) {
+        for (ull x = g[id[i]][w]; x; x &= x - 1) {
+          int j = pos[w * 64 + __builtin_ctzll(x)];
+          adj[i][j >> 6] |= 1ULL << (j & 63);
+        }
+      }
+    }
+    best = 0;
+    ans.clear();
+    if (n == 0) return ans;
+    // root coloring, the i-th branch uses the vertices of the first i branches as candidates
+    Worker root(this);
+    root.reserve(0);
+    for (int i = 0; i < n; i++) root.P[0][i >> 6] |= 1ULL << (i & 63);
+    root.color(0, 1);
+    vector<int> vs = root.vs[0], cs = root.cs[0];
+    int m = vs.size();
+    vector<deque<int>> dq(threads);
+    vector<mutex> dm(threads);
+    for (int i = 0; i < m; i++) dq[i % threads].push_back(i);
+    auto work = [&](int t) {
+      Worker wk(this);
+      wk.reserve(1);
+      while (true) {
+        int i = -1;
+        {
+          lock_guard<mutex> lock(dm[t]);
+          if (!dq[t].empty()) i = dq[t].back(), dq[t].pop_back();
+        }
+        for (int s = 1; s < threads && i == -1; s++) { // steal the smallest branch of someone else
+          int o = (t + s) % threads;
+          lock_guard<mutex> lock(dm[o]);
+          if (!dq[o].empty()) i = dq[o].front(), dq[o].pop_front();
+        }
+        if (i == -1) return;
+        if (cs[i] <= best.load()) continue;
+        vector<ull> &p = wk.P[0];
+        fill(p.begin(), p.end(), 0);
+        for (int j = 0; j < i; j++) p[vs[j] >> 6] |= 1ULL << (vs[j] & 63);
+        wk.branch(1, vs[i]);
+      }
+    };
+    if (threads == 1) work(0);
+    else {
+      vector<thread> pool;
+      for (int t = 0; t < threads; t++) pool.emplace_back(work, t);
+      for (auto &t : pool) t.join();
+    }
+    return ans;
+  }
+};
+array<int, 2> p[2005];
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, d; cin >> n >> d;
+  for (int i = 0; i < n; i++) {
+    cin >> p[i][0] >> p[i][1];
+  }
+  MaxClique M(n);
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      int dis = (p[i][0] - p[j][0]) * (p[i][0] - p[j][0]) + (p[i][1] - p[j][1]) * (p[i][1] - p[j][1]);
+      if (dis <= d * d) {
+        M.add_edge(i, j);
+      }
+    }
+  }
+  vector<int> clique = M.solve(thread::hardware_concurrency());
+  cout << clique.size() << '\n';
+  for (auto i: clique) {
+    cout << i + 1 << ' ';
+  }
+  cout << '\n';
+  return 0;
+}
+// https://vjudge.net/problem/Kattis-sensor
@@ -0,0 +1,191 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Cost Scaling Push-Relabel (Goldberg-Tarjan)
+Same interface as MCMF: add_edge(u, v, cap, cost, id) and solve(s, t, goal) returns {maxflow, mincost}
+First a maximum flow is found with Dinic, then the flow is made optimal by refine phases
+with eps = C * n, C * n / alpha, ..., 1 on costs multiplied by n
+Works with negative costs and negative cycles too (as long as the capacities on the cycles are finite)
+Complexity: O(V^2 E log(V C)) in theory, doesn't depend on the flow value
+Uses FIFO selection and push look-ahead, 1e5 arcs with 1e9 capacities take a few seconds
+Network Simplex is usually faster on sparse transportation instances, this one is more predictable
+*/
+using T = long long;
+const T inf = 1LL << 61;
+struct CostScaling {
+  struct edge {
+    int v, rev;
+    T cap, cost;
+    int id;
+  };
+  int n, s, t, mxid;
+  T flow, cost, eps;
+  vector<vector<edge>> g;
+  vector<T> excess, price, flow_through;
+  vector<int> d, done, cur;
+  static const int alpha = 8;
+  CostScaling() {}
+  CostScaling(int _n) { // 0-based indexing
+    n = _n + 10;
+    g.assign(n, vector<edge> ());
+    mxid = 0;
+  }
+  void add_edge(int u, int v, T cap, T cost, int id = -1, bool directed = true) {
+    if(u == v) { // a self loop can only matter if it is a negative cycle
+      assert(cost >= 0);
+      return;
+    }
+    edge a = {v, (int)g[v].size(), cap, cost, id};
+    edge b = {u, (int)g[u].size(), 0, -cost, -2};
+    g[u].emplace_back(a);
+    g[v].emplace_back(b);
+    mxid = max(mxid, id);
+    if(!directed) add_edge(v, u, cap, cost, -1, true);
+  }
+  bool bfs() {
+    d.assign(n, -1);
+    d[s] = 0;
+    queue<int> q;
+    q.push(s);
+    while(!q.empty()) {
+      int u = q.front();
+      q.pop();
+      for(auto &e : g[u]) {
+        if(d[e.v] == -1 && e.cap > 0) {
+          d[e.v] = d[u] + 1;
+          q.push(e.v);
+        }
+      }
+    }
+    return d[t] != -1;
+  }
+  T dfs(int u, T f) {
+    if(u == t || !f) return f;
+    for(int &i = done[u]; i < (int)g[u].size(); i++) {
+      edge &e = g[u][i];
+      if(d[e.v] == d[u] + 1 && e.cap > 0) {
+        T nw = dfs(e.v, min(f, e.cap));
+        if(nw) {
+          e.cap -= nw;
+          g[e.v][e.rev].cap += nw;
+          return nw;
+        }
+      }
+    }
+    return 0;
+  }
+  inline void push(int u, edge &e, T f) {
+    e.cap -= f;
+    g[e.v][e.rev].cap += f;
+    excess[u] -= f;
+    excess[e.v] += f;
+  }
+  inline T rc(int u, edge &e) {
+    return e.cost + price[u] - price[e.v];
+  }
+  bool relabel(int u) {
+    T mx = -inf;
+    for(int i = 0; i < (int)g[u].size(); i++) {
+      edge &e = g[u][i];
+      if(e.cap > 0 && price[e.v] - e.cost > mx) {
+        mx = price[e.v] - e.cost;
+        cur[u] = i;
+      }
+    }
+    if(mx == -inf) return false;
+    price[u] = mx - eps;
+    return true;
+  }
+  // push look-ahead: a node without excess and without admissible arcs is relabeled instead of pushed into
+  bool look_ahead(int v) {
+    if(excess[v] < 0) return true;
+    for(int &i = cur[v]; i < (int)g[v].size(); i++) {
+      edge &e = g[v][i];
+      if(e.cap > 0 && rc(v, e) < 0) return true;
+    }
+    return !relabel(v);
+  }
+  void refine() {
+    for(int u = 0; u < n; u++) {
+      for(auto &e : g[u]) {
+        if(e.cap > 0 && rc(u, e) < 0) push(u, e, e.cap);
+      }
+    }
+    queue<int> q;
+    for(int u = 0; u < n; u++) if(excess[u] > 0) q.push(u);
+    cur.assign(n, 0);
+    while(!q.empty()) {
+      int u = q.front();
+      q.pop();
+      while(excess[u] > 0) {
+        if(cur[u] == (int)g[u].size()) relabel(u);
+        edge &e = g[u][cur[u]];
+        if(e.cap > 0 && rc(u, e) < 0 && look_ahead(e.v)) {
+          bool was = excess[e.v] > 0;
+          push(u, e, min(excess[u], e.cap));
+          if(!was && excess[e.v] > 0) q.push(e.v);
+        }
+        else cur[u]++;
+      }
+    }
+  }
+  //returns {maxflow, mincost}
+  pair<T, T> solve(int _s, int _t, T goal = inf) {
+    s = _s;
+    t = _t;
+    flow = 0;
+    while(flow < goal && bfs()) {
+      done.assign(n, 0);
+      while(T nw = dfs(s, goal - flow)) flow += nw;
+    }
+    eps = 0;
+    for(int u = 0; u < n; u++) {
+      for(auto &e : g[u]) {
+        e.cost *= n;
+        eps = max(eps, abs(e.cost));
+      }
+    }
+    excess.assign(n, 0);
+    price.assign(n, 0);
+    while(eps > 1) {
+      eps = max(1LL, eps / alpha);
+      refine();
+    }
+    cost = 0;
+    flow_through.assign(mxid + 10, 0);
+    for(int u = 0; u < n; u++) {
+      for(auto &e : g[u]) {
+        e.cost /= n;
+        if(e.id == -2) continue;
+        T f = g[e.v][e.rev].cap;
+        cost += f * e.cost;
+        if(e.id >= 0) flow_through[e.id] = f;
+      }
+    }
+    return make_pair(flow, cost);
+  }
+};
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n;
+  cin >> n;
+  CostScaling F(2 * n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      int k;
+      cin >> k;
+      F.add_edge(i, j + n, 1, k, i * n + j);
+    }
+  }
+  int s = 2 * n + 1, t = s + 1;
+  for (int i = 0; i < n; i++) {
+    F.add_edge(s, i, 1, 0);
+    F.add_edge(i + n, t, 1, 0);
+  }
+  auto ans = F.solve(s, t);
+  assert(ans.first == n);
+  cout << ans.second << '\n';
+  return 0;
+}
@@ -0,0 +1,205 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Network Simplex with block search pivoting
+Same interface as MCMF: add_edge(u, v, cap, cost, id) and solve(s, t, goal) returns {maxflow, mincost}
+Works with negative costs and negative cycles too (as long as the capacities on the cycles are finite)
+Complexity does not depend on the flow value, so it is the one to use when capacities are huge (like 1e9)
+In practice it handles 2e4 nodes and 1e5 arcs with 1e9 capacities and costs in a couple of seconds
+The s-t flow is modelled as a circulation with an extra arc t -> s of cost -(n * max|cost| + 1),
+so maximizing the flow always dominates minimizing the cost
+Spanning tree is kept with parent pointers and sibling lists, an artificial root is connected to every node
+by an arc of cost 0 that can never carry flow
+*/
+using T = long long;
+const T inf = 1LL << 61;
+struct NetworkSimplex {
+  int n, m, mxid;
+  vector<int> from, to, id;
+  vector<T> cap, cost, flow;
+  vector<T> flow_through;
+  // state: 0 = in tree, 1 = at lower bound, -1 = at upper bound
+  vector<int> state, par, pred, depth, fch, nxt, prv;
+  vector<T> pi;
+  NetworkSimplex() {}
+  NetworkSimplex(int _n) { // 0-based indexing
+    n = _n + 10;
+    mxid = 0;
+  }
+  void add_edge(int u, int v, T _cap, T _cost, int _id = -1, bool directed = true) {
+    from.push_back(u); to.push_back(v);
+    cap.push_back(_cap); cost.push_back(_cost);
+    id.push_back(_id);
+    mxid = max(mxid, _id);
+    if(!directed) add_edge(v, u, _cap, _cost, -1, true);
+  }
+  void add_arc(int u, int v, T c, T w) {
+    from.push_back(u); to.push_back(v);
+    cap.push_back(c); cost.push_back(w);
+    id.push_back(-1);
+  }
+  inline T reduced(int a) {
+    return cost[a] + pi[from[a]] - pi[to[a]];
+  }
+  void cut(int v) {
+    int p = par[v];
+    if(prv[v] != -1) nxt[prv[v]] = nxt[v];
+    else fch[p] = nxt[v];
+    if(nxt[v] != -1) prv[nxt[v]] = prv[v];
+    nxt[v] = prv[v] = -1;
+  }
+  void link(int v, int p) {
+    par[v] = p;
+    prv[v] = -1;
+    nxt[v] = fch[p];
+    if(fch[p] != -1) prv[fch[p]] = v;
+    fch[p] = v;
+  }
+  // recompute potentials and depths in the subtree of v, iteratively
+  void update_subtree(int v) {
+    vector<int> st = {v};
+    while(!st.empty()) {
+      int u = st.back();
+      st.pop_back();
+      int p = par[u], a = pred[u];
+      if(from[a] == u) pi[u] = pi[p] - cost[a];
+      else pi[u] = pi[p] + cost[a];
+      depth[u] = depth[p] + 1;
+      for(int c = fch[u]; c != -1; c = nxt[c]) st.push_back(c);
+    }
+  }
+  // residual capacity of the tree arc above w when flow goes from child to parent (up = true)
+  inline T res(int w, bool up) {
+    int a = pred[w];
+    return (from[a] == w) == up ? cap[a] - flow[a] : flow[a];
+  }
+  inline void augment(int w, bool up, T d) {
+    int a = pred[w];
+    if((from[a] == w) == up) flow[a] += d;
+    else flow[a] -= d;
+  }
+  void pivot(int in) {
+    int first = state[in] == 1 ? from[in] : to[in];
+    int second = state[in] == 1 ? to[in] : from[in];
+    int x = first, y = second;
+    while(x != y) {
+      if(depth[x] >= depth[y]) x = par[x];
+      else y = par[y];
+    }
+    int join = x;
+    // flow goes join -> first -> second -> join
+    T d = cap[in];
+    for(int w = first; w != join; w = par[w]) d = min(d, res(w, false));
+    for(int w = second; w != join; w = par[w]) d = min(d, res(w, true));
+    // leaving arc is the last blocking arc on the cycle starting from join
+    int out = -1;
+    bool out_second = false;
+    for(int w = second; w != join; w = par[w]) if(res(w, true) == d) out = w, out_second = true;
+    if(out == -1 && cap[in] != d) {
+      for(int w = first; w != join; w = par[w]) if(res(w, false) == d) {
+          out = w;
+          break;
+        }
+    }
+    if(d > 0) {
+      flow[in] += state[in] * d;
+      for(int w = first; w != join; w = par[w]) augment(w, false, d);
+      for(int w = second; w != join; w = par[w]) augment(w, true, d);
+    }
+    if(out == -1) { // the entering arc itself leaves
+      state[in] = -state[in];
+      return;
+    }
+    int la = pred[out];
+    state[la] = flow[la] == 0 ? 1 : -1;
+    state[in] = 0;
+    // the part between out and the entering arc gets rehung
+    int q = out_second ? second : first, o = out_second ? first : second;
+    int prev_node = o, prev_arc = in;
+    for(int w = q; ; ) {
+      int pw = par[w], pa = pred[w];
+      cut(w);
+      link(w, prev_node);
+      pred[w] = prev_arc;
+      if(w == out) break;
+      prev_node = w, prev_arc = pa;
+      w = pw;
+    }
+    update_subtree(q);
+  }
+  //returns {maxflow, mincost}
+  pair<T, T> solve(int s, int t, T goal = inf) {
+    m = from.size();
+    T mx = 0, out_cap = 0;
+    for(int i = 0; i < m; i++) {
+      mx = max(mx, abs(cost[i]));
+      if(from[i] == s) out_cap = min(inf, out_cap + cap[i]);
+    }
+    add_arc(t, s, min(goal, out_cap), -(mx * n + 1));
+    int root = n;
+    for(int v = 0; v < n; v++) add_arc(v, root, inf, 0);
+    int tot = from.size();
+    flow.assign(tot, 0);
+    state.assign(tot, 1);
+    par.assign(n + 1, -1); pred.assign(n + 1, -1); depth.assign(n + 1, 0);
+    fch.assign(n + 1, -1); nxt.assign(n + 1, -1); prv.assign(n + 1, -1);
+    pi.assign(n + 1, 0);
+    for(int v = 0; v < n; v++) {
+      pred[v] = m + 1 + v;
+      state[m + 1 + v] = 0;
+      depth[v] = 1;
+      link(v, root);
+    }
+    int block = max(10, (int)sqrt(m + 1)), cur = 0;
+    while(true) {
+      int in = -1, cnt = 0;
+      T best = 0;
+      for(int k = 0; k <= m; k++) {
+        int a = cur;
+        if(++cur > m) cur = 0;
+        if(state[a]) {
+          T v = state[a] * reduced(a);
+          if(v < best) best = v, in = a;
+        }
+        if(++cnt == block) {
+          if(in != -1) break;
+          cnt = 0;
+        }
+      }
+      if(in == -1) break;
+      pivot(in);
+    }
+    T fl = flow[m], cst = 0;
+    flow_through.assign(mxid + 10, 0);
+    for(int i = 0; i < m; i++) {
+      cst += flow[i] * cost[i];
+      if(id[i] >= 0) flow_through[id[i]] = flow[i];
+    }
+    from.resize(m); to.resize(m); cap.resize(m); cost.resize(m); id.resize(m);
+    return make_pair(fl, cst);
+  }
+};
+int main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n;
+  cin >> n;
+  NetworkSimplex F(2 * n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      int k;
+      cin >> k;
+      F.add_edge(i, j + n, 1, k, i * n + j);
+    }
+  }
+  int s = 2 * n + 1, t = s + 1;
+  for (int i = 0; i < n; i++) {
+    F.add_edge(s, i, 1, 0);
+    F.add_edge(i + n, t, 1, 0);
+  }
+  auto ans = F.solve(s, t);
+  assert(ans.first == n);
+  cout << ans.second << '\n';
+  return 0;
+}
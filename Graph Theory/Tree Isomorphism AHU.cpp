@@ -0,0 +1,185 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Tree Isomorphism with AHU canonical ids, no hashing of the trees so no collisions
+Rooted: nodes are processed level by level from the deepest one, the (parent, child id) pairs of a level
+are radix sorted so every parent gets its sorted list of child ids, and that list is mapped
+to an integer id through a table shared by all the trees
+Two rooted trees are isomorphic iff their roots get the same id
+Unrooted: rooted at the center, with two centers the smaller of the two ids is taken
+The table is split into shards with their own lock, so many trees can be canonized in parallel
+classify() puts a batch of trees into isomorphism classes that way
+Complexity: O(n) per tree plus the table lookups (a level of k nodes is sorted in O(k)), everything iterative
+0-indexed
+*/
+struct TreeCanonizer {
+  struct VecHash {
+    size_t operator()(const vector<int> &v) const {
+      unsigned long long h = v.size() * 0x9E3779B97F4A7C15ULL;
+      for (int x : v) {
+        h ^= x + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+        h *= 0xBF58476D1CE4E5B9ULL;
+      }
+      return h ^ (h >> 31);
+    }
+  };
+  static const int SHARDS = 64;
+  struct Shard {
+    mutex mtx;
+    unordered_map<vector<int>, int, VecHash> ids;
+  };
+  vector<Shard> table;
+  atomic<int> cnt;
+  TreeCanonizer(): table(SHARDS), cnt(0) {}
+  int get_id(const vector<int> &ch) {
+    Shard &s = table[VecHash()(ch) % SHARDS];
+    lock_guard<mutex> lock(s.mtx);
+    auto it = s.ids.find(ch);
+    if (it != s.ids.end()) return it->second;
+    int id = cnt++;
+    s.ids.emplace(ch, id);
+    return id;
+  }
+  // stable sort of (key, value) pairs by key with keys in [0, 2^31), LSD radix with digits of about log2(size)
+  // bits (8 to 16) so a pass is O(size) and not O(65536), a digit equal for every key is skipped
+  static void radix_sort(vector<pair<int, int>> &a, vector<pair<int, int>> &tmp, vector<int> &c) {
+    if (a.size() < 64) {
+      stable_sort(a.begin(), a.end(), [](auto &x, auto &y) {
+        return x.first < y.first;
+      });
+      return;
+    }
+    unsigned o = 0, an = ~0U;
+    for (auto &p : a) o |= p.first, an &= p.first;
+    int bits = max(8, min(16, __lg((int)a.size()) + 1)), M = (1 << bits) - 1;
+    tmp.resize(a.size());
+    for (int sh = 0; sh < 32; sh += bits) {
+      if (!((o ^ an) >> sh & M)) continue;
+      c.assign(M + 2, 0);
+      for (auto &p : a) c[((unsigned)p.first >> sh & M) + 1]++;
+      for (int i = 0; i <= M; i++) c[i + 1] += c[i];
+      for (auto &p : a) tmp[c[(unsigned)p.first >> sh & M]++] = p;
+      a.swap(tmp);
+    }
+  }
+  // stable sort of (key, value) pairs by key with keys in [0, K), O(size + K)
+  static void counting_sort(vector<pair<int, int>> &a, vector<pair<int, int>> &tmp, vector<int> &c, int K) {
+    tmp.resize(a.size());
+    c.assign(K + 1, 0);
+    for (auto &p : a) c[p.first + 1]++;
+    for (int i = 0; i < K; i++) c[i + 1] += c[i];
+    for (auto &p : a) tmp[c[p.first]++] = p;
+    a.swap(tmp);
+  }
+  // canonical id of the tree rooted at root, g is the tree in CSR (st, adj)
+  int rooted(int n, const vector<int> &st, const vector<int> &adj, int root) {
+    vector<int> order = {root}, par(n, -1), pos(n), id(n), lvl = {0};
+    order.reserve(n);
+    for (int i = 0; i < (int)order.size(); i++) {
+      int u = order[i];
+      for (int j = st[u]; j < st[u + 1]; j++) {
+        int v = adj[j];
+        if (v == par[u]) continue;
+        par[v] = u;
+        order.push_back(v);
+      }
+    }
+    // level boundaries in bfs order
+    vector<int> dep(n, 0);
+    for (int i = 1; i < n; i++) dep[order[i]] = dep[par[order[i]]] + 1;
+    for (int i = 1; i < n; i++) if (dep[order[i]] != dep[order[i - 1]]) lvl.push_back(i);
+    lvl.push_back(n);
+    vector<pair<int, int>> pr, tmp;
+    vector<int> ch, cbuf; // counters of the sorts, allocated once per tree
+    for (int L = (int)lvl.size() - 2; L >= 0; L--) {
+      int a = lvl[L], b = lvl[L + 1], c = lvl[min(L + 2, (int)lvl.size() - 1)];
+      for (int i = a; i < b; i++) pos[order[i]] = i - a;
+      // children of this level sorted by id, then grouped by parent (stable)
+      pr.clear();
+      for (int i = b; i < c; i++) pr.push_back({id[order[i]], pos[par[order[i]]]});
+      radix_sort(pr, tmp, cbuf);
+      for (auto &p : pr) swap(p.first, p.second);
+      counting_sort(pr, tmp, cbuf, b - a); // pos of the parents < b - a
+      for (int i = a, k = 0; i < b; i++) {
+        ch.clear();
+        while (k < (int)pr.size() && pr[k].first == i - a) ch.push_back(pr[k++].second);
+        id[order[i]] = get_id(ch);
+      }
+    }
+    return id[root];
+  }
+  // canonical id of an unrooted tree given by its edges
+  int unrooted(int n, const vector<pair<int, int>> &edges) {
+    if (n <= 1) return rooted(max(n, 1), vector<int>(2, 0), {}, 0);
+    vector<int> st(n + 1, 0), adj(2 * (n - 1)), deg(n, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, st[v + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i], deg[i] = st[i + 1] - st[i];
+    vector<int> p(st.begin(), st.end() - 1);
+    for (auto &[u, v] : edges) adj[p[u]++] = v, adj[p[v]++] = u;
+    // peel the leaves layer by layer, the last one or two nodes are the centers
+    vector<int> layer, nxt;
+    for (int i = 0; i < n; i++) if (deg[i] <= 1) layer.push_back(i);
+    int left = n;
+    while (left > 2) {
+      left -= layer.size();
+      nxt.clear();
+      for (int u : layer) {
+        for (int j = st[u]; j < st[u + 1]; j++) if (--deg[adj[j]] == 1) nxt.push_back(adj[j]);
+      }
+      layer.swap(nxt);
+    }
+    int ans = rooted(n, st, adj, layer[0]);
+    if (layer.size() == 2) ans = min(ans, rooted(n, st, adj, layer[1]));
+    return ans;
+  }
+  // class of every tree, trees in the same class are isomorphic, classes are numbered by first occurrence
+  vector<int> classify(const vector<pair<int, vector<pair<int, int>>>> &trees, int threads = 1) {
+    int k = trees.size();
+    vector<int> can(k);
+    atomic<int> nxt(0);
+    auto work = [&]() {
+      for (int i; (i = nxt++) < k; ) can[i] = unrooted(trees[i].first, trees[i].second);
+    };
+    threads = max(1, threads);
+    if (threads == 1) work();
+    else {
+      vector<thread> pool;
+      for (int t = 0; t < threads; t++) pool.emplace_back(work);
+      for (auto &t : pool) t.join();
+    }
+    unordered_map<int, int> cls;
+    vector<int> ans(k);
+    for (int i = 0; i < k; i++) {
+      auto it = cls.find(can[i]);
+      if (it == cls.end()) it = cls.emplace(can[i], cls.size()).first;
+      ans[i] = it->second;
+    }
+    return ans;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+
+  int t;
+  cin >> t;
+  TreeCanonizer C;
+  while(t--) {
+    int n;
+    cin >> n;
+    vector<pair<int, int>> e1(n - 1), e2(n - 1);
+    for(auto &[u, v] : e1) {
+      cin >> u >> v;
+      --u; --v;
+    }
+    for(auto &[u, v] : e2) {
+      cin >> u >> v;
+      --u; --v;
+    }
+    if(C.unrooted(n, e1) == C.unrooted(n, e2)) cout << "YES\n";
+    else cout << "NO\n";
+  }
+  return 0;
+}
+// https://www.spoj.com/problems/TREEISO/
@@ -0,0 +1,257 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Triangle and 4-cycle counting for big simple graphs, multi-edges and self loops are removed on build
+Nodes are renumbered in degeneracy order (bucket based core decomposition), every adjacency list in CSR
+is sorted, so the oriented graph (edges to higher numbers) is just the tail of every list, no extra memory,
+and every out-degree is at most the degeneracy d
+Triangles: every triangle u < v < w is found once as out(u) ∩ out(v), the intersection is picked by the
+size ratio: galloping (exponential + binary search) for very different sizes, otherwise an all-pairs
+compare of blocks of 8 against 8 that the compiler turns into AVX2 compares, then a plain merge for the tail
+Per node counts come from the same pass, so the local clustering coefficients are 2t(v) / (deg(v)(deg(v) - 1))
+4-cycles: every cycle is counted once at its highest node v with the opposite node i, by counting the
+paths i - u - v with u, i < v, pairs of such paths give the cycles
+Outer loops are split into chunks of nodes taken by the threads, totals are per thread and added at the end,
+per node counts use relaxed atomic adds
+Complexity: O(m d) for both, O(n + m log) to build, memory: 2m ints + (n + 1) offsets
+0-indexed
+*/
+struct CycleCounter {
+  int n, threads;
+  vector<pair<int, int>> edges;
+  vector<long long> st, ost; // adjacency of node r is adj[st[r], st[r + 1]), the out part starts at ost[r]
+  vector<int> adj, rnk, id; // rnk[v] = new number of the original node v, id[r] = original node
+  vector<long long> tri; // triangles through every original node, filled by triangles(true)
+  CycleCounter() {}
+  CycleCounter(int _n, int _threads = 1): n(_n), threads(max(1, _threads)) {}
+  void add_edge(int u, int v) {
+    edges.emplace_back(u, v);
+  }
+  template<typename F>
+  void parallel_for(int cnt, F f) {
+    if (threads == 1 || cnt == 1) {
+      for (int i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<int> nxt(0);
+    vector<thread> pool;
+    for (int t = 0; t < min(threads, cnt); t++) {
+      pool.emplace_back([&]() {
+        for (int i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+  static const int CH = 1024;
+  // sorts and dedups every list, returns the new degrees
+  vector<int> clean() {
+    vector<int> d(n);
+    parallel_for((n + CH - 1) / CH, [&](int c) {
+      for (int u = c * CH; u < min(n, (c + 1) * CH); u++) {
+        int *b = adj.data() + st[u], *e = adj.data() + st[u + 1];
+        sort(b, e);
+        e = unique(b, e);
+        e = remove(b, e, u);
+        d[u] = e - b;
+      }
+    });
+    long long p = 0;
+    for (int u = 0; u < n; u++) {
+      long long s = st[u];
+      st[u] = p;
+      for (int i = 0; i < d[u]; i++) adj[p++] = adj[s + i];
+    }
+    st[n] = p;
+    adj.resize(p);
+    adj.shrink_to_fit();
+    return d;
+  }
+  void build() {
+    st.assign(n + 1, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, st[v + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    adj.resize(st[n]);
+    {
+      vector<long long> pos(st.begin(), st.end() - 1);
+      for (auto &[u, v] : edges) adj[pos[u]++] = v, adj[pos[v]++] = u;
+    }
+    vector<pair<int, int>>().swap(edges);
+    vector<int> d = clean();
+    // degeneracy order: repeatedly take a node of minimum remaining degree
+    int md = n ? *max_element(d.begin(), d.end()) : 0;
+    vector<int> bin(md + 2, 0), pos(n), vert(n), deg(d);
+    for (int u = 0; u < n; u++) bin[deg[u] + 1]++;
+    for (int i = 0; i <= md; i++) bin[i + 1] += bin[i];
+    for (int u = 0; u < n; u++) pos[u] = bin[deg[u]]++, vert[pos[u]] = u;
+    for (int i = md; i > 0; i--) bin[i] = bin[i - 1];
+    bin[0] = 0;
+    for (int i = 0; i < n; i++) {
+      int v = vert[i];
+      for (long long j = st[v]; j < st[v + 1]; j++) {
+        int u = adj[j];
+        if (deg[u] > deg[v]) {
+          int du = deg[u], pu = pos[u], pw = bin[du], w = vert[pw];
+          if (u != w) pos[u] = pw, vert[pu] = w, pos[w] = pu, vert[pw] = u;
+          bin[du]++;
+          deg[u]--;
+        }
+      }
+    }
+    id = vert;
+    rnk.resize(n);
+    for (int i = 0; i < n; i++) rnk[id[i]] = i;
+    // renumber
+    vector<long long> nst(n + 1, 0);
+    for (int r = 0; r < n; r++) nst[r + 1] = nst[r] + d[id[r]];
+    vector<int> nadj(nst[n]);
+    parallel_for((n + CH - 1) / CH, [&](int c) {
+      for (int r = c * CH; r < min(n, (c + 1) * CH); r++) {
+        int v = id[r];
+        long long p = nst[r];
+        for (long long j = st[v]; j < st[v + 1]; j++) nadj[p++] = rnk[adj[j]];
+        sort(nadj.begin() + nst[r], nadj.begin() + nst[r + 1]);
+      }
+    });
+    st.swap(nst);
+    adj.swap(nadj);
+    ost.resize(n);
+    for (int r = 0; r < n; r++) ost[r] = upper_bound(adj.begin() + st[r], adj.begin() + st[r + 1], r) - adj.begin();
+  }
+  // |a ∩ b| for sorted lists without duplicates, f(x) is called for every common x when REPORT
+  template<bool REPORT, typename F>
+  static long long intersect(const int *a, int na, const int *b, int nb, F f) {
+    if (na > nb) swap(a, b), swap(na, nb);
+    long long c = 0;
+    if (!na || a[na - 1] < b[0] || b[nb - 1] < a[0]) return 0;
+    if (nb > 32LL * na) { // galloping
+      int lo = 0;
+      for (int i = 0; i < na && lo < nb; i++) {
+        int x = a[i], step = 1, hi = lo;
+        while (hi < nb && b[hi] < x) lo = hi + 1, hi += step, step <<= 1;
+        hi = min(hi, nb);
+        lo = lower_bound(b + lo, b + hi, x) - b;
+        if (lo < nb && b[lo] == x) {
+          c++;
+          if (REPORT) f(x);
+          lo++;
+        }
+      }
+      return c;
+    }
+    int i = 0, j = 0;
+    while (i + 8 <= na && j + 8 <= nb) {
+      int hit[8];
+      for (int x = 0; x < 8; x++) {
+        int h = 0;
+        for (int y = 0; y < 8; y++) h |= a[i + x] == b[j + y];
+        hit[x] = h;
+      }
+      for (int x = 0; x < 8; x++) {
+        c += hit[x];
+        if (REPORT && hit[x]) f(a[i + x]);
+      }
+      int ma = a[i + 7], mb = b[j + 7];
+      i += (ma <= mb) * 8;
+      j += (mb <= ma) * 8;
+    }
+    while (i < na && j < nb) {
+      if (a[i] < b[j]) i++;
+      else if (a[i] > b[j]) j++;
+      else {
+        c++;
+        if (REPORT) f(a[i]);
+        i++, j++;
+      }
+    }
+    return c;
+  }
+  // number of triangles, with per_node = true also fills tri[v]
+  long long triangles(bool per_node = false) {
+    vector<long long> t;
+    if (per_node) t.assign(n, 0);
+    atomic<long long> total(0);
+    parallel_for((n + CH - 1) / CH, [&](int c) {
+      long long loc = 0;
+      for (int u = c * CH; u < min(n, (c + 1) * CH); u++) {
+        const int *ou = adj.data() + ost[u];
+        int nu = st[u + 1] - ost[u];
+        long long tu = 0;
+        for (int k = 0; k < nu; k++) {
+          int v = ou[k];
+          long long x;
+          if (per_node) {
+            x = intersect<true>(ou + k + 1, nu - k - 1, adj.data() + ost[v], st[v + 1] - ost[v], [&](int w) {
+              __atomic_fetch_add(&t[w], 1, __ATOMIC_RELAXED);
+            });
+            if (x) __atomic_fetch_add(&t[v], x, __ATOMIC_RELAXED);
+          } else x = intersect<false>(ou + k + 1, nu - k - 1, adj.data() + ost[v], st[v + 1] - ost[v], [](int) {});
+          tu += x;
+        }
+        if (per_node && tu) __atomic_fetch_add(&t[u], tu, __ATOMIC_RELAXED);
+        loc += tu;
+      }
+      total += loc;
+    });
+    if (per_node) {
+      tri.assign(n, 0);
+      for (int r = 0; r < n; r++) tri[id[r]] = t[r];
+    }
+    return total;
+  }
+  // local clustering coefficient of the original node v, needs triangles(true)
+  double clustering(int v) {
+    long long d = st[rnk[v] + 1] - st[rnk[v]];
+    return d < 2 ? 0 : 2.0 * tri[v] / (d * (d - 1));
+  }
+  long long cycle4() {
+    atomic<long long> total(0);
+    int th = min(threads, max(1, n / CH));
+    atomic<int> nxt(0);
+    auto work = [&]() {
+      vector<int> val(n, 0);
+      long long loc = 0;
+      for (int c; (c = nxt++) * CH < n; ) {
+        for (int i = c * CH; i < min(n, (c + 1) * CH); i++) {
+          for (long long j = st[i]; j < st[i + 1]; j++) {
+            int u = adj[j];
+            // v > u and v > i
+            long long k = u < i ? upper_bound(adj.begin() + ost[u], adj.begin() + st[u + 1], i) - adj.begin() : ost[u];
+            for (; k < st[u + 1]; k++) loc += val[adj[k]]++;
+          }
+          for (long long j = st[i]; j < st[i + 1]; j++) {
+            int u = adj[j];
+            for (long long k = ost[u]; k < st[u + 1]; k++) val[adj[k]] = 0;
+          }
+        }
+      }
+      total += loc;
+    };
+    if (th == 1) work();
+    else {
+      vector<thread> pool;
+      for (int t = 0; t < th; t++) pool.emplace_back(work);
+      for (auto &t : pool) t.join();
+    }
+    return total;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n, m;
+  cin >> n >> m;
+  CycleCounter C(n, thread::hardware_concurrency());
+  for (int i = 0; i < m; i++) {
+    int u, v;
+    cin >> u >> v;
+    C.add_edge(u - 1, v - 1);
+  }
+  C.build();
+  cout << C.triangles() << ' ' << C.cycle4() << '\n';
+  return 0;
+}
@@ -0,0 +1,258 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Virtual trees for a whole batch of key sets at once
+The tree is preprocessed once: iterative dfs for tin/tout/depth, LCA in O(1) with the RMQ over the preorder
+(blocks of 64 with in-block masks + sparse table on the block minimums, same as LCA Linear)
+A query only sorts preorder numbers (ints), not nodes: the keys' tins are sorted (radix for big sets,
+insertion sort for small ones), the LCAs of the neighbours are added and the list is sorted again,
+a key is tin * 2 and an added LCA is tin * 2 + 1 so after the sort the key copy survives the dedup
+Parents come from one stack pass, so the virtual tree comes out in preorder with local parent indices:
+iterate backwards for a bottom-up dp, forwards for a top-down one
+All the virtual trees go to one arena: the nodes of query i are vnode[vst[i]], ..., vnode[vst[i + 1] - 1],
+vpar = local index of the parent (-1 for the root), vkey = 1 if the node is one of the keys
+Queries are taken in chunks by the threads, every thread has its own scratch buffers, no allocation per query
+Complexity: O(n) preprocessing, O(k) per query with k keys (plus the sort), O(1) per LCA
+0-indexed
+*/
+struct VirtualTreeBatch {
+  int n, root;
+  vector<pair<int, int>> edges;
+  vector<int> st, adj, par, dep, tin, tout, order;
+  vector<unsigned long long> mask;
+  vector<vector<int>> sp;
+  vector<int> qst = {0}, qkeys; // queries in CSR
+  vector<int> vst, vnode, vpar;
+  vector<char> vkey;
+  VirtualTreeBatch() {}
+  VirtualTreeBatch(int _n): n(_n) {}
+  void add_edge(int u, int v) {
+    edges.emplace_back(u, v);
+  }
+  inline int better(int i, int j) {
+    return dep[order[i]] <= dep[order[j]] ? i : j;
+  }
+  void build(int _root = 0) {
+    root = _root;
+    st.assign(n + 1, 0);
+    for (auto &[u, v] : edges) st[u + 1]++, st[v + 1]++;
+    for (int i = 0; i < n; i++) st[i + 1] += st[i];
+    adj.resize(st[n]);
+    vector<int> pos(st.begin(), st.end() - 1);
+    for (auto &[u, v] : edges) adj[pos[u]++] = v, adj[pos[v]++] = u;
+    par.assign(n, -1);
+    dep.assign(n, 0);
+    tin.assign(n, -1);
+    tout.assign(n, -1);
+    order.clear();
+    order.reserve(n);
+    vector<int> stk = {root}, it(st.begin(), st.end() - 1);
+    tin[root] = 0;
+    order.push_back(root);
+    while (!stk.empty()) {
+      int u = stk.back();
+      if (it[u] == st[u + 1]) {
+        tout[u] = order.size();
+        stk.pop_back();
+        continue;
+      }
+      int v = adj[it[u]++];
+      if (v == par[u]) continue;
+      par[v] = u;
+      dep[v] = dep[u] + 1;
+      tin[v] = order.size();
+      order.push_back(v);
+      stk.push_back(v);
+    }
+    int m = order.size();
+    mask.assign(m, 0);
+    int nb = (m + 63) >> 6;
+    vector<int> stack_, bmin(nb);
+    for (int b = 0; b < nb; b++) {
+      int l = b << 6, r = min(m, l + 64);
+      unsigned long long cur = 0;
+      stack_.clear();
+      for (int i = l; i < r; i++) {
+        while (!stack_.empty() && dep[order[stack_.back()]] > dep[order[i]]) {
+          cur &= ~(1ULL << (stack_.back() - l));
+          stack_.pop_back();
+        }
+        stack_.push_back(i);
+        cur |= 1ULL << (i - l);
+        mask[i] = cur;
+      }
+      bmin[b] = l + __builtin_ctzll(mask[r - 1]);
+    }
+    int lg = 1;
+    while ((1 << lg) <= nb) lg++;
+    sp.assign(lg, bmin);
+    for (int k = 1; k < lg; k++) {
+      for (int b = 0; b + (1 << k) <= nb; b++) sp[k][b] = better(sp[k - 1][b], sp[k - 1][b + (1 << (k - 1))]);
+    }
+  }
+  int query(int l, int r) {
+    int bl = l >> 6, br = r >> 6;
+    if (bl == br) return l + __builtin_ctzll(mask[r] >> (l & 63));
+    int ans = better(l + __builtin_ctzll(mask[(bl << 6) + 63] >> (l & 63)), (br << 6) + __builtin_ctzll(mask[r]));
+    if (bl + 1 < br) {
+      int k = __lg(br - bl - 1);
+      ans = better(ans, better(sp[k][bl + 1], sp[k][br - (1 << k)]));
+    }
+    return ans;
+  }
+  // lca of the nodes at preorder positions a <= b, as a preorder position
+  inline int lca_pos(int a, int b) {
+    if (a == b) return a;
+    return tin[par[order[query(a + 1, b)]]];
+  }
+  int lca(int u, int v) {
+    if (tin[u] > tin[v]) swap(u, v);
+    return order[lca_pos(tin[u], tin[v])];
+  }
+  bool is_anc(int u, int v) {
+    return tin[u] <= tin[v] && tout[v] <= tout[u];
+  }
+  void add_query(const vector<int> &keys) {
+    qkeys.insert(qkeys.end(), keys.begin(), keys.end());
+    qst.push_back(qkeys.size());
+  }
+  void clear_queries() {
+    qst.assign(1, 0);
+    qkeys.clear();
+  }
+  struct Scratch {
+    vector<unsigned> a, tmp, stk;
+    vector<int> cnt;
+  };
+  static void sort_keys(vector<unsigned> &a, Scratch &s) {
+    int k = a.size();
+    if (k <= 64) {
+      for (int i = 1; i < k; i++) {
+        unsigned x = a[i];
+        int j = i - 1;
+        while (j >= 0 && a[j] > x) a[j + 1] = a[j], j--;
+        a[j + 1] = x;
+      }
+      return;
+    }
+    unsigned mx = *max_element(a.begin(), a.end());
+    s.tmp.resize(k);
+    s.cnt.resize(1 << 11 | 1);
+    for (int sh = 0; sh < 32 && (mx >> sh); sh += 11) {
+      fill(s.cnt.begin(), s.cnt.end(), 0);
+      for (unsigned x : a) s.cnt[(x >> sh & 2047) + 1]++;
+      for (int i = 0; i < 2048; i++) s.cnt[i + 1] += s.cnt[i];
+      for (unsigned x : a) s.tmp[s.cnt[x >> sh & 2047]++] = x;
+      a.swap(s.tmp);
+    }
+  }
+  // builds the virtual tree of query q into the arena starting at out, returns its size
+  int build_one(int q, int out, Scratch &s) {
+    auto &a = s.a;
+    a.clear();
+    for (int i = qst[q]; i < qst[q + 1]; i++) a.push_back((unsigned)tin[qkeys[i]] << 1);
+    if (a.empty()) return 0;
+    sort_keys(a, s);
+    a.erase(unique(a.begin(), a.end()), a.end());
+    int k = a.size();
+    for (int i = 0; i + 1 < k; i++) a.push_back((unsigned)lca_pos(a[i] >> 1, a[i + 1] >> 1) << 1 | 1);
+    sort_keys(a, s);
+    int sz = 0;
+    auto &stk = s.stk;
+    stk.clear();
+    for (int i = 0; i < (int)a.size(); i++) {
+      if (i && (a[i] >> 1) == (a[i - 1] >> 1)) continue;
+      int v = order[a[i] >> 1];
+      while (!stk.empty() && tout[vnode[out + stk.back()]] <= tin[v]) stk.pop_back();
+      vnode[out + sz] = v;
+      vpar[out + sz] = stk.empty() ? -1 : stk.back();
+      vkey[out + sz] = !(a[i] & 1);
+      stk.push_back(sz++);
+    }
+    return sz;
+  }
+  // builds the virtual trees of all the added queries
+  void solve(int threads = 1) {
+    int Q = qst.size() - 1;
+    vector<long long> cap(Q + 1, 0);
+    for (int q = 0; q < Q; q++) cap[q + 1] = cap[q] + max(0, 2 * (qst[q + 1] - qst[q]) - 1);
+    vector<int> tmp_node(cap[Q]), tmp_par(cap[Q]), sz(Q);
+    vector<char> tmp_key(cap[Q]);
+    vnode.swap(tmp_node), vpar.swap(tmp_par), vkey.swap(tmp_key);
+    const int CH = 256;
+    atomic<int> nxt(0);
+    auto work = [&]() {
+      Scratch s;
+      for (int c; (c = nxt.fetch_add(CH)) < Q; ) {
+        for (int q = c; q < min(Q, c + CH); q++) sz[q] = build_one(q, cap[q], s);
+      }
+    };
+    threads = max(1, threads);
+    if (threads == 1) work();
+    else {
+      vector<thread> pool;
+      for (int t = 0; t < threads; t++) pool.emplace_back(work);
+      for (auto &t : pool) t.join();
+    }
+    // compact the arena
+    vst.assign(Q + 1, 0);
+    for (int q = 0; q < Q; q++) vst[q + 1] = vst[q] + sz[q];
+    tmp_node.resize(vst[Q]), tmp_par.resize(vst[Q]), tmp_key.resize(vst[Q]);
+    for (int q = 0; q < Q; q++) {
+      copy(vnode.begin() + cap[q], vnode.begin() + cap[q] + sz[q], tmp_node.begin() + vst[q]);
+      copy(vpar.begin() + cap[q], vpar.begin() + cap[q] + sz[q], tmp_par.begin() + vst[q]);
+      copy(vkey.begin() + cap[q], vkey.begin() + cap[q] + sz[q], tmp_key.begin() + vst[q]);
+    }
+    vnode.swap(tmp_node), vpar.swap(tmp_par), vkey.swap(tmp_key);
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n;
+  cin >> n;
+  VirtualTreeBatch V(n);
+  for (int i = 1; i < n; i++) {
+    int u, v;
+    cin >> u >> v;
+    V.add_edge(u - 1, v - 1);
+  }
+  V.build(0);
+  int q;
+  cin >> q;
+  vector<int> keys;
+  for (int i = 0; i < q; i++) {
+    int k;
+    cin >> k;
+    keys.resize(k);
+    for (auto &x : keys) cin >> x, --x;
+    V.add_query(keys);
+  }
+  V.solve(thread::hardware_concurrency());
+  vector<char> imp(n, 0);
+  vector<int> up, cnt;
+  for (int i = 0; i < q; i++) {
+    int l = V.vst[i], r = V.vst[i + 1], ans = 0;
+    for (int j = V.qst[i]; j < V.qst[i + 1]; j++) imp[V.qkeys[j]] = 1;
+    bool fl = true;
+    for (int j = V.qst[i]; j < V.qst[i + 1]; j++) {
+      int x = V.qkeys[j];
+      if (V.par[x] != -1 && imp[V.par[x]]) fl = false;
+    }
+    if (fl) {
+      up.assign(r - l, 0);
+      cnt.assign(r - l, 0);
+      for (int j = r - l - 1; j >= 0; j--) {
+        if (V.vkey[l + j]) ans += cnt[j], up[j] = 1;
+        else if (cnt[j] > 1) ans++, up[j] = 0;
+        else up[j] = cnt[j];
+        if (V.vpar[l + j] != -1 && up[j]) cnt[V.vpar[l + j]]++;
+      }
+    }
+    cout << (fl ? ans : -1) << '\n';
+    for (int j = V.qst[i]; j < V.qst[i + 1]; j++) imp[V.qkeys[j]] = 0;
+  }
+  return 0;
+}
+// https://codeforces.com/contest/613/problem/D
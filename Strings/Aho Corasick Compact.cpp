@@ -0,0 +1,235 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Aho-Corasick for a lot of patterns over bytes (any char, 256 letters), the automaton is read only after compute()
+so any number of threads can scan with it
+Transitions are not a full row per node: after compute() the nodes are renumbered in bfs order so the children
+of a node are consecutive and sorted by letter, child(u, c) = base[u] + rank of c among the letters of u
+- a node with at most one child only keeps that letter (most nodes of long patterns)
+- a node with more children keeps a 256 bit mask with the prefix popcounts of its 4 words, rank = popcount
+- the root has a full row of 256 (with the failure transitions already resolved)
+so a node is 24 bytes: 16 for the Node (first child, letter or mask, suffix link and match count: one load
+per step) + 8 for out_link and head (only read to report matches), + 48 bytes for every branching node and
+4 bytes per pattern (pnext), against 1KB for a full 256 int row
+Missing transitions follow the suffix links like advance() of AC, amortized O(1) per letter
+scan() keeps the state in a Stream so the text can come in chunks of any size, positions are global,
+while at the root it skips the letters that start no pattern in a tight loop without any transition
+count() only adds cnt[state] = number of patterns ending at this state (with its suffix links), no output walk
+Complexity: O(sum of |patterns| * log) to build, O(|text| + number of reported matches) to scan
+0-indexed, pattern ids in the order of add_pattern, equal patterns get different ids and are all reported,
+an empty pattern is rejected (add_pattern returns -1 and no id is used)
+*/
+struct ACCompact {
+  using ull = unsigned long long;
+  struct Mask {
+    ull w[4];
+    int pre[4];
+  };
+  // tr >= 0: index of the mask, tr == -1: leaf, tr < -1: the only child is the letter -2 - tr
+  struct Node {
+    int base, tr, link, cnt;
+  };
+  struct Stream {
+    int state = 0;
+    long long pos = 0; // number of letters already scanned
+  };
+  int N, P;
+  // build time trie: first child / next sibling lists, freed by compute()
+  vector<int> tfirst, tsib, thead;
+  vector<unsigned char> tlab;
+  int troot[256];
+  // automaton
+  vector<Node> t;
+  vector<int> out_link, head, pnext;
+  vector<Mask> mk;
+  int go0[256];
+  ACCompact(): N(1), P(0), tfirst(1, -1), tsib(1, -1), thead(1, -1), tlab(1, 0) {
+    memset(troot, -1, sizeof troot);
+  }
+  int add_pattern(const string &T) {
+    if (T.empty()) return -1; // it would end at the root, which is never reported
+    int u = 0;
+    for (unsigned char c : T) {
+      int v = u ? tfirst[u] : troot[c];
+      if (u) while (v != -1 && tlab[v] != c) v = tsib[v];
+      if (v == -1) {
+        v = N++;
+        tfirst.push_back(-1), thead.push_back(-1), tlab.push_back(c);
+        if (u) tsib.push_back(tfirst[u]), tfirst[u] = v;
+        else tsib.push_back(-1), troot[c] = v;
+      }
+      u = v;
+    }
+    pnext.push_back(thead[u]);
+    thead[u] = P;
+    return P++;
+  }
+  inline int child(int u, int c) const {
+    const Node &x = t[u];
+    if (x.tr < 0) return -2 - x.tr == c ? x.base : -1;
+    const Mask &m = mk[x.tr];
+    ull w = m.w[c >> 6], bit = 1ULL << (c & 63);
+    if (!(w & bit)) return -1;
+    return x.base + m.pre[c >> 6] + __builtin_popcountll(w & (bit - 1));
+  }
+  inline int advance(int u, unsigned char c) const {
+    for (; u; u = t[u].link) {
+      int v = child(u, c);
+      if (v != -1) return v;
+    }
+    return go0[c];
+  }
+  void compute() {
+    // bfs over the trie, the children of every node are taken sorted by letter
+    vector<int> ord = {0}, par = {-1}, kids;
+    ord.reserve(N), par.reserve(N);
+    t.assign(N, {0, -1, 0, 0});
+    mk.clear();
+    for (int i = 0; i < (int)ord.size(); i++) {
+      int u = ord[i];
+      kids.clear();
+      if (!u) {
+        for (int c = 0; c < 256; c++) if (troot[c] != -1) kids.push_back(troot[c]);
+      } else {
+        for (int v = tfirst[u]; v != -1; v = tsib[v]) kids.push_back(v);
+        sort(kids.begin(), kids.end(), [&](int a, int b) {
+          return tlab[a] < tlab[b];
+        });
+      }
+      t[i].base = ord.size();
+      if (kids.size() == 1) t[i].tr = -2 - tlab[kids[0]];
+      else if (kids.size() > 1) {
+        Mask m = {};
+        for (int v : kids) m.w[tlab[v] >> 6] |= 1ULL << (tlab[v] & 63);
+        for (int k = 1; k < 4; k++) m.pre[k] = m.pre[k - 1] + __builtin_popcountll(m.w[k - 1]);
+        t[i].tr = mk.size();
+        mk.push_back(m);
+      }
+      for (int v : kids) ord.push_back(v), par.push_back(i);
+    }
+    vector<int> nhead(N), lab(N);
+    for (int i = 0; i < N; i++) nhead[i] = thead[ord[i]], lab[i] = tlab[ord[i]];
+    head.swap(nhead);
+    vector<int>().swap(tfirst), vector<int>().swap(tsib), vector<int>().swap(thead);
+    vector<unsigned char>().swap(tlab);
+    vector<int>().swap(ord);
+    for (int c = 0; c < 256; c++) go0[c] = max(0, child(0, c));
+    out_link.assign(N, 0);
+    for (int v = 1; v < N; v++) {
+      int u = par[v], l = u ? advance(t[u].link, lab[v]) : 0;
+      t[v].link = l;
+      out_link[v] = head[l] == -1 ? out_link[l] : l;
+      for (int p = head[v]; p != -1; p = pnext[p]) t[v].cnt++;
+      t[v].cnt += t[l].cnt;
+    }
+  }
+  // f(end, p): pattern p ends at the global position end of the stream, returns the number of matches
+  template<typename F>
+  long long scan(Stream &s, const char *text, size_t len, F f) const {
+    const unsigned char *a = (const unsigned char *)text;
+    long long res = 0;
+    int u = s.state;
+    for (size_t i = 0; i < len; i++) {
+      if (!u) {
+        while (i < len && !go0[a[i]]) i++;
+        if (i == len) break;
+        u = go0[a[i]];
+      } else u = advance(u, a[i]);
+      if (!t[u].cnt) continue;
+      res += t[u].cnt;
+      for (int v = head[u] == -1 ? out_link[u] : u; v; v = out_link[v]) {
+        for (int p = head[v]; p != -1; p = pnext[p]) f(s.pos + (long long)i, p);
+      }
+    }
+    s.state = u;
+    s.pos += len;
+    return res;
+  }
+  // number of matches in the chunk, without reporting them
+  long long count(Stream &s, const char *text, size_t len) const {
+    const unsigned char *a = (const unsigned char *)text;
+    long long res = 0;
+    int u = s.state;
+    for (size_t i = 0; i < len; i++) {
+      if (!u) {
+        while (i < len && !go0[a[i]]) i++;
+        if (i == len) break;
+        u = go0[a[i]];
+      } else u = advance(u, a[i]);
+      res += t[u].cnt;
+    }
+    s.state = u;
+    s.pos += len;
+    return res;
+  }
+  template<typename F>
+  static void parallel_for(int cnt, int threads, F f) {
+    if (threads <= 1 || cnt <= 1) {
+      for (int i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<int> nxt(0);
+    vector<thread> pool;
+    for (int k = 0; k < min(threads, cnt); k++) {
+      pool.emplace_back([&]() {
+        for (int i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &th : pool) th.join();
+  }
+  // chunk i of every independent stream i, f(i, end, p) must be thread safe, returns the matches per stream
+  template<typename F>
+  vector<long long> scan_parallel(vector<Stream> &ss, const vector<pair<const char *, size_t>> &chunks, int threads, F f) const {
+    vector<long long> res(ss.size());
+    parallel_for(ss.size(), threads, [&](int i) {
+      res[i] = scan(ss[i], chunks[i].first, chunks[i].second, [&](long long end, int p) {
+        f(i, end, p);
+      });
+    });
+    return res;
+  }
+  vector<long long> count_parallel(vector<Stream> &ss, const vector<pair<const char *, size_t>> &chunks, int threads) const {
+    vector<long long> res(ss.size());
+    parallel_for(ss.size(), threads, [&](int i) {
+      res[i] = count(ss[i], chunks[i].first, chunks[i].second);
+    });
+    return res;
+  }
+};
+
+// Problem:  You are given n patterns (sum of the lengths of which is sum <= 10^5), and also a text string s.
+// Find the minimum number of substring partitions that we can have of the text string such that each partition exists in the given patterns.
+// The text is fed in chunks of 4096 to show the streaming scan, the matches come out in increasing end position
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int t, cs = 0; cin >> t;
+  while (t--) {
+    int n; cin >> n;
+    vector<string> v(n);
+    for (auto &s : v) cin >> s;
+    sort(v.begin(), v.end());
+    v.erase(unique(v.begin(), v.end()), v.end());
+    ACCompact aho;
+    vector<int> len;
+    for (auto &s : v) {
+      aho.add_pattern(s);
+      len.push_back(s.size());
+    }
+    aho.compute();
+    string s; cin >> s;
+    n = s.size();
+    vector<int> dp(n, n + 10);
+    ACCompact::Stream st;
+    for (int i = 0; i < n; i += 4096) {
+      aho.scan(st, s.data() + i, min(n - i, 4096), [&](long long e, int p) {
+        dp[e] = min(dp[e], (e - len[p] >= 0 ? dp[e - len[p]] : 0) + 1);
+      });
+    }
+    cout << "Case " << ++cs << ": ";
+    if (dp[n - 1] >= n + 10) cout << "impossible\n";
+    else cout << dp[n - 1] << '\n';
+  }
+  return 0;
+}
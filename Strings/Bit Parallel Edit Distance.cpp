@@ -0,0 +1,155 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Bit-parallel edit distance (Levenshtein) and LCS of a pattern a (runtime length m) against texts b
+One column of the DP over a is kept as bit vectors of 64 bit words (blocks), peq[c] = positions of c in a
+Edit distance: Myers / Hyyro, the vertical deltas are Pv (+1) and Mv (-1), every block gets the horizontal
+delta of the block above (hin in {-1, 0, 1}) and hands its last row's delta to the block below,
+the score is the value of the last row of every block
+Thresholded / banded (k >= 0): only the blocks meeting the rows j - k .. j + k are computed for column j
+(Ukkonen: D[i][j] >= |i - j|), a block entering the band starts from an upper bound (+1 per row) and the
+block above the band is replaced by hin = +1, both only change cells > k, returns -1 if the distance is > k
+LCS: Allison-Dix / Hyyro, V = ones, U = V & peq[c], V = (V + U) | (V & ~peq[c]), LCS = zeros of V
+Batch4: 4 pairs (a[i], b[i]) with |a[i]| <= 64 at once, the 4 lanes are 4 ull in a row so the update
+is one AVX2 instruction per operation for the 4 pairs, a finished lane is kept by a mask
+Complexity: O(ceil(m / 64) n), O(ceil(k / 32) n) with the threshold, O(max |b|) per batch of 4 short pairs
+*/
+struct BitPattern {
+  using ull = unsigned long long;
+  int m, W;
+  vector<ull> peq; // peq[c * W + w]
+  BitPattern() {}
+  BitPattern(string_view a): m(a.size()), W(max(1, ((int)a.size() + 63) >> 6)), peq(256 * W, 0) {
+    for (int i = 0; i < m; i++) peq[(unsigned char)a[i] * W + (i >> 6)] |= 1ULL << (i & 63);
+  }
+  // one block of one column, hin = delta of the row above, returns the delta of the row top
+  static inline int advance(ull &Pv, ull &Mv, ull Eq, int hin, int top) {
+    ull Xv = Eq | Mv;
+    if (hin < 0) Eq |= 1;
+    ull Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+    ull Ph = Mv | ~(Xh | Pv), Mh = Pv & Xh;
+    int hout = (int)(Ph >> top & 1) - (int)(Mh >> top & 1);
+    Ph <<= 1, Mh <<= 1;
+    if (hin < 0) Mh |= 1;
+    else if (hin > 0) Ph |= 1;
+    Pv = Mh | ~(Xv | Ph), Mv = Ph & Xv;
+    return hout;
+  }
+  // edit distance to b, with k >= 0 returns -1 if it is more than k
+  int edit_distance(string_view b, int k = -1) const {
+    int n = b.size();
+    if (k < 0 || k > max(m, n)) k = max(m, n);
+    if (abs(m - n) > k) return -1;
+    if (!m) return n;
+    vector<ull> Pv(W, ~0ULL), Mv(W, 0);
+    vector<int> sc(W);
+    for (int x = 0; x < W; x++) sc[x] = min(m, 64 * (x + 1));
+    int first = 0, last = min(W - 1, max(0, k - 1) >> 6), top = (m - 1) & 63;
+    for (int j = 1; j <= n; j++) {
+      if (last < W - 1 && (j + k - 1) >> 6 > last) {
+        last++;
+        Pv[last] = ~0ULL, Mv[last] = 0;
+        sc[last] = sc[last - 1] + min(m, 64 * (last + 1)) - 64 * last;
+      }
+      if (j - k - 1 >= 0) first = max(first, (j - k - 1) >> 6);
+      const ull *E = peq.data() + (unsigned char)b[j - 1] * W;
+      int h = 1;
+      for (int x = first; x <= last; x++) {
+        h = advance(Pv[x], Mv[x], E[x], h, x == W - 1 ? top : 63);
+        sc[x] += h;
+      }
+    }
+    return sc[W - 1] <= k ? sc[W - 1] : -1;
+  }
+  int lcs(string_view b) const {
+    vector<ull> V(W, ~0ULL);
+    for (unsigned char c : b) {
+      const ull *M = peq.data() + c * W;
+      ull carry = 0;
+      for (int x = 0; x < W; x++) {
+        ull U = V[x] & M[x], s = V[x] + U, t = s + carry;
+        carry = (s < U) | (t < s);
+        V[x] = t | (V[x] & ~M[x]);
+      }
+    }
+    int res = m;
+    for (int x = 0; x < W; x++) {
+      ull mask = x == W - 1 && (m & 63) ? (1ULL << (m & 63)) - 1 : ~0ULL;
+      res -= __builtin_popcountll(V[x] & mask);
+    }
+    return m ? res : 0;
+  }
+};
+struct Batch4 {
+  using ull = unsigned long long;
+  alignas(32) ull peq[4][256];
+  Batch4() {
+    memset(peq, 0, sizeof peq);
+  }
+  // LCS = false: res[i] = edit distance of a[i], b[i], LCS = true: res[i] = lcs, every |a[i]| <= 64
+  template<bool LCS>
+  void run(const string_view *a, const string_view *b, int *res) {
+    alignas(32) ull Pv[4], Mv[4], Eq[4], top[4], act[4];
+    alignas(32) long long sc[4];
+    int n = 0;
+    for (int l = 0; l < 4; l++) {
+      assert(a[l].size() <= 64);
+      for (size_t i = 0; i < a[l].size(); i++) peq[l][(unsigned char)a[l][i]] |= 1ULL << i;
+      Pv[l] = ~0ULL, Mv[l] = 0, sc[l] = a[l].size(), top[l] = a[l].empty() ? 0 : a[l].size() - 1;
+      n = max(n, (int)b[l].size());
+    }
+    for (int j = 0; j < n; j++) {
+      for (int l = 0; l < 4; l++) {
+        bool in = j < (int)b[l].size();
+        Eq[l] = in ? peq[l][(unsigned char)b[l][j]] : 0;
+        act[l] = -(ull)in;
+      }
+      if (LCS) {
+        for (int l = 0; l < 4; l++) {
+          ull U = Pv[l] & Eq[l], V = (Pv[l] + U) | (Pv[l] & ~Eq[l]);
+          Pv[l] = (V & act[l]) | (Pv[l] & ~act[l]);
+        }
+      } else {
+        for (int l = 0; l < 4; l++) {
+          ull Xv = Eq[l] | Mv[l], Xh = (((Eq[l] & Pv[l]) + Pv[l]) ^ Pv[l]) | Eq[l];
+          ull Ph = Mv[l] | ~(Xh | Pv[l]), Mh = Pv[l] & Xh;
+          sc[l] += (long long)((Ph >> top[l]) & 1 & act[l]) - (long long)((Mh >> top[l]) & 1 & act[l]);
+          Ph = Ph << 1 | 1, Mh <<= 1;
+          ull P = Mh | ~(Xv | Ph), M = Ph & Xv;
+          Pv[l] = (P & act[l]) | (Pv[l] & ~act[l]);
+          Mv[l] = (M & act[l]) | (Mv[l] & ~act[l]);
+        }
+      }
+    }
+    for (int l = 0; l < 4; l++) {
+      int m = a[l].size();
+      if (LCS) res[l] = m - __builtin_popcountll(m == 64 ? Pv[l] : Pv[l] & ((1ULL << m) - 1));
+      else res[l] = m ? sc[l] : b[l].size();
+      for (int i = 0; i < m; i++) peq[l][(unsigned char)a[l][i]] = 0;
+    }
+  }
+  void edit_distance(const string_view *a, const string_view *b, int *res) {
+    run<false>(a, b, res);
+  }
+  void lcs(const string_view *a, const string_view *b, int *res) {
+    run<true>(a, b, res);
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int t;
+  cin >> t;
+  while (t--) {
+    string a, b;
+    cin >> a >> b;
+    cout << BitPattern(a).edit_distance(b) << '\n';
+  }
+  return 0;
+}
+// https://www.spoj.com/problems/EDIST/
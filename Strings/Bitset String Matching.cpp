@@ -0,0 +1,174 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Shift-and matching on occurrence bitmaps, the text size is given at runtime (no bitset<N>)
+occ[c]: bit i is set iff t[i] == c, one row of W 64 bit words per letter that occurs in the text, every row
+starts on a 64 byte boundary and has a zero word after its end
+Pattern p of length m occurs at i iff occ[p[j]] has bit i + j for every j, so res = AND of (occ[p[j]] >> j),
+the shift of a word range is w[k + j / 64] >> (j % 64) | w[k + j / 64 + 1] << (64 - j % 64), plain word loops
+that the compiler turns into AVX2 (4 words per instruction)
+Batches: the text is cut into blocks of B words (B * 64 positions), every block is done for all the patterns
+of the batch before the next one, so the rows of the block are loaded from memory once and stay in L2
+for the whole batch (sigma * B * 8 bytes = 104 KB for lowercase)
+Rarest letter first: the positions of a pattern are processed by increasing number of occurrences of their
+letter, the AND also ORs the words so a block stops as soon as nothing survives (usually after 2 - 3 rows
+on random text)
+Regex-lite: '.' is any letter, [abc] is one of a, b, c (ORed rows, a run a-z is allowed), \x is the letter x
+Complexity: O(sigma n / 64) memory words, O(m n / 64) per pattern worst case, O(n / 64) for the usual one
+0-indexed, f(id, pos) gets the index of the pattern in the batch and the start of the occurrence
+*/
+struct BitText {
+  using ull = unsigned long long;
+  static constexpr int B = 512;
+  int n, W, S, sigma;
+  int id[256];
+  vector<long long> freq;
+  vector<ull> mem;
+  ull *occ; // occ + id[c] * S
+  BitText() {}
+  BitText(string_view t): n(t.size()) {
+    W = (n + 63) >> 6;
+    S = (W + 1 + 7) & ~7; // a zero word after the end, a multiple of 8 words = 64 bytes
+    fill(id, id + 256, -1);
+    sigma = 0;
+    for (unsigned char c : t) if (id[c] == -1) id[c] = sigma++;
+    freq.assign(sigma, 0);
+    mem.assign((size_t)sigma * S + 8, 0);
+    occ = mem.data();
+    while ((uintptr_t)occ & 63) occ++;
+    for (int i = 0; i < n; i++) {
+      int c = id[(unsigned char)t[i]];
+      occ[(size_t)c * S + (i >> 6)] |= 1ULL << (i & 63);
+      freq[c]++;
+    }
+  }
+  const ull *row(int c) const {
+    return occ + (size_t)c * S;
+  }
+  // one position of a pattern: the letters allowed there (empty for a letter that is not in the text)
+  struct Pos {
+    int off;
+    vector<int> letters;
+    long long weight;
+  };
+  struct Query {
+    int m;
+    vector<Pos> pos; // '.' positions are left out
+  };
+  // returns false if the pattern can not occur (empty, too long, a position allows no letter of the text)
+  bool compile(string_view p, Query &q) const {
+    q.m = 0, q.pos.clear();
+    bool ok = true;
+    for (size_t i = 0; i < p.size(); i++, q.m++) {
+      if (p[i] == '.') continue;
+      vector<bool> in(256, false);
+      if (p[i] == '[') {
+        size_t j = i + 1;
+        for (; j < p.size() && p[j] != ']'; j++) {
+          if (p[j] == '\\' && j + 1 < p.size()) j++;
+          if (j + 2 < p.size() && p[j + 1] == '-' && p[j + 2] != ']') {
+            for (int c = (unsigned char)p[j]; c <= (unsigned char)p[j + 2]; c++) in[c] = true;
+            j += 2;
+          } else in[(unsigned char)p[j]] = true;
+        }
+        i = j;
+      } else {
+        if (p[i] == '\\' && i + 1 < p.size()) i++;
+        in[(unsigned char)p[i]] = true;
+      }
+      Pos x = {q.m, {}, 0};
+      for (int c = 0; c < 256; c++) if (in[c] && id[c] != -1) x.letters.push_back(id[c]), x.weight += freq[id[c]];
+      ok &= !x.letters.empty();
+      q.pos.push_back(x);
+    }
+    sort(q.pos.begin(), q.pos.end(), [](const Pos &a, const Pos &b) {
+      return a.weight < b.weight;
+    });
+    return ok && q.m && q.m <= n;
+  }
+  // res[0, len) &= (w >> s) on words [k0, k0 + len), returns the OR of the new res
+  static ull shift_and(ull *res, const ull *w, int s, int len) {
+    ull any = 0;
+    if (!s) {
+      for (int k = 0; k < len; k++) res[k] &= w[k], any |= res[k];
+    } else {
+      for (int k = 0; k < len; k++) res[k] &= (w[k] >> s) | (w[k + 1] << (64 - s)), any |= res[k];
+    }
+    return any;
+  }
+  // f(id, pos) for the occurrences of every pattern, block by block and inside a block pattern by pattern
+  template<typename F>
+  void match(const vector<string_view> &pats, F f) const {
+    int k = pats.size();
+    vector<Query> qs(k);
+    vector<char> ok(k);
+    for (int i = 0; i < k; i++) ok[i] = compile(pats[i], qs[i]);
+    alignas(64) ull res[B], tmp[B + 1];
+    for (int b = 0; b < W; b += B) {
+      for (int i = 0; i < k; i++) if (ok[i]) {
+        const Query &q = qs[i];
+        int last = n - max(q.m, 1); // last possible start
+        if (b * 64 > last) continue;
+        int len = min(B, (last >> 6) + 1 - b);
+        fill(res, res + len, ~0ULL);
+        if ((last >> 6) < b + len) res[len - 1] = (last & 63) == 63 ? ~0ULL : (2ULL << (last & 63)) - 1;
+        ull any = 1;
+        for (const Pos &x : q.pos) {
+          int w0 = b + (x.off >> 6), s = x.off & 63;
+          // the words w0 .. w0 + len are inside the row: (b + len - 1) * 64 + off <= last + m - 1 < n
+          const ull *w = row(x.letters[0]) + w0;
+          if (x.letters.size() > 1) {
+            copy(w, w + len + 1, tmp);
+            for (size_t j = 1; j < x.letters.size(); j++) {
+              const ull *v = row(x.letters[j]) + w0;
+              for (int t = 0; t <= len; t++) tmp[t] |= v[t];
+            }
+            w = tmp;
+          }
+          if (!(any = shift_and(res, w, s, len))) break;
+        }
+        if (!any) continue;
+        for (int t = 0; t < len; t++) {
+          for (ull x = res[t]; x; x &= x - 1) f(i, ((b + t) << 6) + __builtin_ctzll(x));
+        }
+      }
+    }
+  }
+  // number of occurrences of every pattern
+  vector<long long> count(const vector<string_view> &pats) const {
+    vector<long long> res(pats.size(), 0);
+    match(pats, [&](int i, int) {
+      res[i]++;
+    });
+    return res;
+  }
+  size_t memory_usage() const {
+    return mem.capacity() * sizeof(ull);
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  string s;
+  int q;
+  cin >> s >> q;
+  BitText T(s);
+  vector<string> p(q);
+  for (auto &x : p) cin >> x;
+  vector<string_view> pv(p.begin(), p.end());
+  vector<vector<int>> pos(q);
+  T.match(pv, [&](int i, int x) {
+    pos[i].push_back(x);
+  });
+  for (int i = 0; i < q; i++) {
+    cout << pos[i].size() << '\n'; // number of occurrences
+    for (auto x : pos[i]) cout << x << ' '; // positions of the occurrences
+    cout << '\n';
+  }
+  return 0;
+}
@@ -0,0 +1,332 @@
+#include<bits/stdc++.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+using namespace std;
+
+/*
+FM-index: a compressed self-index of a byte string, the text itself is not kept
+Built from the SA-IS of Suffix Array.cpp (the letters are shifted by one so the sentinel is 0, any byte works)
+BWT[r] = s[sa[r] - 1] over the letters that occur, coded 1..sigma, the sentinel is 0
+Rank on the BWT: wavelet matrix with ceil(log2(sigma + 1)) levels, every level is a bit vector in blocks of
+256 bits with the ones before the block in front (5 words, rank = 1 lookup + at most 4 popcounts),
+the rank of c at i is the position reached at the last level minus bot[c] (the position reached from 0)
+so one rank per level, count() = 2 ranks per level per letter of the pattern
+locate: the rows of the positions multiple of rate are marked (bit vector with rank) and keep position / rate,
+LF is followed until a marked row, at most rate - 1 steps
+extract: the rows of the positions multiple of rate are kept, LF walks back from the first one >= r
+Size: (log2(sigma + 1) * 1.25 + 1.25) bits per letter + 2 * (n / rate) * log2(n) bits,
+DNA: ~0.8 bytes per letter with rate 32, ~0.7 with rate 64, against 4n + n bytes for sa + text
+Serialized: everything is one array of 64 bit words (header, C, bot, levels, marks, packed samples),
+save() writes it and load() mmaps the file read only and points into it, nothing is copied (a file whose
+header does not match its size is refused and the index that was loaded before is kept)
+Complexity: O(n) build (SA-IS), count O(|p| log sigma), locate O(rate log sigma) per occurrence,
+extract O((r - l + rate) log sigma)
+0-indexed
+*/
+void induced_sort(const vector<int> &vec, int val_range, vector<int> &SA, const vector<bool> &sl, const vector<int> &lms_idx) {
+  vector<int> l(val_range, 0), r(val_range, 0);
+  for (int c : vec) {
+    if (c + 1 < val_range) ++l[c + 1];
+    ++r[c];
+  }
+  partial_sum(l.begin(), l.end(), l.begin());
+  partial_sum(r.begin(), r.end(), r.begin());
+  fill(SA.begin(), SA.end(), -1);
+  for (int i = lms_idx.size() - 1; i >= 0; --i)
+    SA[--r[vec[lms_idx[i]]]] = lms_idx[i];
+  for (int i : SA)
+    if (i >= 1 && sl[i - 1]) {
+      SA[l[vec[i - 1]]++] = i - 1;
+    }
+  fill(r.begin(), r.end(), 0);
+  for (int c : vec)
+    ++r[c];
+  partial_sum(r.begin(), r.end(), r.begin());
+  for (int k = SA.size() - 1, i = SA[k]; k >= 1; --k, i = SA[k])
+    if (i >= 1 && !sl[i - 1]) {
+      SA[--r[vec[i - 1]]] = i - 1;
+    }
+}
+vector<int> SA_IS(const vector<int> &vec, int val_range) {
+  const int n = vec.size();
+  vector<int> SA(n), lms_idx;
+  vector<bool> sl(n);
+  sl[n - 1] = false;
+  for (int i = n - 2; i >= 0; --i) {
+    sl[i] = (vec[i] > vec[i + 1] || (vec[i] == vec[i + 1] && sl[i + 1]));
+    if (sl[i] && !sl[i + 1]) lms_idx.push_back(i + 1);
+  }
+  reverse(lms_idx.begin(), lms_idx.end());
+  induced_sort(vec, val_range, SA, sl, lms_idx);
+  vector<int> new_lms_idx(lms_idx.size()), lms_vec(lms_idx.size());
+  for (int i = 0, k = 0; i < n; ++i)
+    if (!sl[SA[i]] && SA[i] >= 1 && sl[SA[i] - 1]) {
+      new_lms_idx[k++] = SA[i];
+    }
+  int cur = 0;
+  SA[n - 1] = cur;
+  for (size_t k = 1; k < new_lms_idx.size(); ++k) {
+    int i = new_lms_idx[k - 1], j = new_lms_idx[k];
+    if (vec[i] != vec[j]) {
+      SA[j] = ++cur;
+      continue;
+    }
+    bool flag = false;
+    for (int a = i + 1, b = j + 1;; ++a, ++b) {
+      if (vec[a] != vec[b]) {
+        flag = true;
+        break;
+      }
+      if ((!sl[a] && sl[a - 1]) || (!sl[b] && sl[b - 1])) {
+        flag = !((!sl[a] && sl[a - 1]) && (!sl[b] && sl[b - 1]));
+        break;
+      }
+    }
+    SA[j] = (flag ? ++cur : cur);
+  }
+  for (size_t i = 0; i < lms_idx.size(); ++i)
+    lms_vec[i] = SA[lms_idx[i]];
+  if (cur + 1 < (int)lms_idx.size()) {
+    auto lms_SA = SA_IS(lms_vec, cur + 1);
+    for (size_t i = 0; i < lms_idx.size(); ++i) {
+      new_lms_idx[i] = lms_idx[lms_SA[i]];
+    }
+  }
+  induced_sort(vec, val_range, SA, sl, new_lms_idx);
+  return SA;
+}
+struct FMIndex {
+  using u64 = unsigned long long;
+  static constexpr u64 MAGIC = 0x31304d4449584d46ULL;
+  // header: magic, n, sigma, levels, rate, width of the sampled positions, width of the sampled rows
+  u64 n, N, sigma, L, rate, ws, wi, nb;
+  vector<u64> own;
+  u64 *mem = nullptr;
+  size_t maplen = 0;
+  u64 *C, *bot, *Z, *lev, *mark, *samp, *isa;
+  uint16_t *code;
+  unsigned char *sym;
+  FMIndex() {}
+  FMIndex(const FMIndex &) = delete;
+  FMIndex &operator=(const FMIndex &) = delete;
+  ~FMIndex() {
+    if (maplen) munmap(mem, maplen);
+  }
+  static u64 width(u64 x) {
+    return max(1, 64 - __builtin_clzll(max<u64>(x, 1)));
+  }
+  // size in words of the index with header h, 0 if h is not a header build() writes (checked before any
+  // division by rate, n < 2^40 keeps the sizes below from overflowing)
+  static u64 words(const u64 *h) {
+    u64 n = h[1], sigma = h[2], L = h[3], rate = h[4], ws = h[5], wi = h[6];
+    if (h[0] != MAGIC || !rate || n >> 40 || sigma > 255 || L != width(sigma)) return 0;
+    if (ws != width(n / rate) || wi != width(n)) return 0;
+    u64 nb = (n + 1) / 256 + 1, k = n / rate + 1;
+    return 8 + (sigma + 2) + (sigma + 1) + L + 64 + 33 + L * nb * 5 + nb * 5 + (k * ws + 63) / 64 + 1 + (k * wi + 63) / 64 + 1;
+  }
+  // sets the pointers from the header, returns the size in words
+  u64 layout(u64 *p) {
+    n = p[1], sigma = p[2], L = p[3], rate = p[4], ws = p[5], wi = p[6];
+    N = n + 1, nb = N / 256 + 1;
+    u64 k = n / rate + 1, o = 8;
+    C = p + o, o += sigma + 2;
+    bot = p + o, o += sigma + 1;
+    Z = p + o, o += L;
+    code = (uint16_t *)(p + o), o += 64;
+    sym = (unsigned char *)(p + o), o += 33;
+    lev = p + o, o += L * nb * 5;
+    mark = p + o, o += nb * 5;
+    samp = p + o, o += (k * ws + 63) / 64 + 1;
+    isa = p + o, o += (k * wi + 63) / 64 + 1;
+    return o;
+  }
+  // bit vectors: blocks of [ones before the block, 4 words]
+  static inline u64 rank1(const u64 *b, u64 i) {
+    const u64 *p = b + (i >> 8) * 5;
+    u64 r = p[0], k = i >> 6 & 3;
+    for (u64 j = 0; j < k; j++) r += __builtin_popcountll(p[1 + j]);
+    if (i & 63) r += __builtin_popcountll(p[1 + k] << (64 - (i & 63)));
+    return r;
+  }
+  static inline int bit(const u64 *b, u64 i) {
+    return b[(i >> 8) * 5 + 1 + (i >> 6 & 3)] >> (i & 63) & 1;
+  }
+  static void set_bit(u64 *b, u64 i) {
+    b[(i >> 8) * 5 + 1 + (i >> 6 & 3)] |= 1ULL << (i & 63);
+  }
+  static void finish(u64 *b, u64 blocks) {
+    u64 r = 0;
+    for (u64 j = 0; j < blocks; j++) {
+      b[j * 5] = r;
+      for (int k = 1; k <= 4; k++) r += __builtin_popcountll(b[j * 5 + k]);
+    }
+  }
+  // packed arrays of w bit values
+  static inline u64 get(const u64 *a, u64 w, u64 i) {
+    u64 p = i * w, x = a[p >> 6] >> (p & 63);
+    if ((p & 63) + w > 64) x |= a[(p >> 6) + 1] << (64 - (p & 63));
+    return w == 64 ? x : x & ((1ULL << w) - 1);
+  }
+  static void put(u64 *a, u64 w, u64 i, u64 v) {
+    u64 p = i * w;
+    a[p >> 6] |= v << (p & 63);
+    if ((p & 63) + w > 64) a[(p >> 6) + 1] |= v >> (64 - (p & 63));
+  }
+  void build(const string &s, int _rate = 32) {
+    if (maplen) munmap(mem, maplen), maplen = 0; // the index was loaded, it now lives in own
+    vector<int> vec(s.size() + 1, 0);
+    for (size_t i = 0; i < s.size(); i++) vec[i] = (unsigned char)s[i] + 1;
+    vector<int> sa = s.empty() ? vector<int>{0} : SA_IS(vec, 257); // sa[0] = n, the sentinel
+    vector<int>().swap(vec);
+    u64 h[8] = {MAGIC, s.size()};
+    int cd[256] = {};
+    for (unsigned char c : s) cd[c] = 1;
+    u64 sg = 0;
+    for (int c = 0; c < 256; c++) if (cd[c]) cd[c] = ++sg;
+    h[2] = sg, h[3] = width(sg), h[4] = _rate, h[5] = width(s.size() / _rate), h[6] = width(s.size());
+    own.assign(8, 0);
+    copy(h, h + 8, own.begin());
+    own.resize(layout(own.data()), 0);
+    mem = own.data();
+    layout(mem);
+    for (int c = 0; c < 256; c++) if (cd[c]) code[c] = cd[c], sym[cd[c]] = c;
+    vector<uint16_t> cur(N), nxt(N);
+    for (u64 r = 0; r < N; r++) cur[r] = sa[r] ? code[(unsigned char)s[sa[r] - 1]] : 0;
+    for (u64 r = 0; r < N; r++) C[cur[r] + 1]++;
+    for (u64 c = 0; c <= sigma; c++) C[c + 1] += C[c];
+    for (u64 l = 0; l < L; l++) {
+      u64 *b = lev + l * nb * 5, z = 0, sh = L - 1 - l;
+      for (u64 r = 0; r < N; r++) {
+        if (cur[r] >> sh & 1) set_bit(b, r);
+        else nxt[z++] = cur[r];
+      }
+      Z[l] = z;
+      for (u64 r = 0; r < N; r++) if (cur[r] >> sh & 1) nxt[z++] = cur[r];
+      finish(b, nb);
+      cur.swap(nxt);
+    }
+    for (u64 c = 0; c <= sigma; c++) {
+      u64 p = 0;
+      for (u64 l = 0; l < L; l++) {
+        const u64 *b = lev + l * nb * 5;
+        p = c >> (L - 1 - l) & 1 ? Z[l] + rank1(b, p) : p - rank1(b, p);
+      }
+      bot[c] = p;
+    }
+    for (u64 r = 0, k = 0; r < N; r++) if (sa[r] % rate == 0) {
+      set_bit(mark, r);
+      put(samp, ws, k++, sa[r] / rate);
+      put(isa, wi, sa[r] / rate, r);
+    }
+    finish(mark, nb);
+  }
+  // number of the letter c in BWT[0, i)
+  inline u64 rank(u64 c, u64 i) const {
+    for (u64 l = 0; l < L; l++) {
+      const u64 *b = lev + l * nb * 5;
+      i = c >> (L - 1 - l) & 1 ? Z[l] + rank1(b, i) : i - rank1(b, i);
+    }
+    return i - bot[c];
+  }
+  // row of the suffix sa[r] - 1, c = its first letter (BWT[r]), r must not be the row of the suffix 0
+  inline u64 LF(u64 r, u64 &c) const {
+    c = 0;
+    for (u64 l = 0; l < L; l++) {
+      const u64 *b = lev + l * nb * 5;
+      int x = bit(b, r);
+      c = c << 1 | x;
+      r = x ? Z[l] + rank1(b, r) : r - rank1(b, r);
+    }
+    return C[c] + r - bot[c];
+  }
+  // rows [sp, ep) of the suffixes starting with p
+  pair<u64, u64> range(const string &p) const {
+    u64 sp = 0, ep = N;
+    for (size_t i = p.size(); i-- > 0 && sp < ep; ) {
+      u64 c = code[(unsigned char)p[i]];
+      if (!c) return {0, 0};
+      sp = C[c] + rank(c, sp), ep = C[c] + rank(c, ep);
+    }
+    return {sp, ep};
+  }
+  u64 count(const string &p) const {
+    auto [sp, ep] = range(p);
+    return ep - sp;
+  }
+  u64 locate_row(u64 r) const {
+    u64 steps = 0, c;
+    while (!bit(mark, r)) r = LF(r, c), steps++;
+    return get(samp, ws, rank1(mark, r)) * rate + steps;
+  }
+  // starting positions of the occurrences of p, not sorted
+  vector<u64> locate(const string &p) const {
+    auto [sp, ep] = range(p);
+    vector<u64> res;
+    for (u64 r = sp; r < ep; r++) res.push_back(locate_row(r));
+    return res;
+  }
+  // s[l, r)
+  string extract(u64 l, u64 r) const {
+    r = min(r, n);
+    if (l >= r) return "";
+    u64 p = min(n, (r + rate - 1) / rate * rate), row = p == n ? 0 : get(isa, wi, p / rate), c;
+    string res;
+    for (; p > l; p--) {
+      row = LF(row, c);
+      if (p <= r) res.push_back(sym[c]);
+    }
+    reverse(res.begin(), res.end());
+    return res;
+  }
+  u64 size_in_bytes() const {
+    return layout_words() * 8;
+  }
+  u64 layout_words() const {
+    return (isa - mem) + ((n / rate + 1) * wi + 63) / 64 + 1;
+  }
+  bool save(const string &path) const {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(mem, 8, layout_words(), f) == layout_words();
+    return fclose(f) == 0 && ok;
+  }
+  bool load(const string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    struct stat sb;
+    if (fd < 0) return false;
+    if (fstat(fd, &sb) || sb.st_size < 64) return close(fd), false;
+    void *p = mmap(nullptr, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return false;
+    // the header is checked on the new mapping, the current index stays usable if the file is bad
+    u64 w = words((const u64 *)p);
+    if (!w || w * 8 > (u64)sb.st_size) return munmap(p, sb.st_size), false;
+    if (maplen) munmap(mem, maplen);
+    vector<u64>().swap(own);
+    mem = (u64 *)p, maplen = sb.st_size;
+    layout(mem);
+    return true;
+  }
+};
+// Given a text and q patterns, print the number of occurrences of every pattern and the sorted starting positions
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  string s;
+  int q;
+  cin >> s >> q;
+  FMIndex F;
+  F.build(s, 16);
+  while (q--) {
+    string p;
+    cin >> p;
+    auto pos = F.locate(p);
+    sort(pos.begin(), pos.end());
+    cout << pos.size();
+    for (auto x : pos) cout << ' ' << x;
+    cout << '\n';
+  }
+  return 0;
+}
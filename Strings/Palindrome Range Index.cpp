@@ -0,0 +1,273 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Manacher in parallel + number of palindromic substrings of s[l, r] in O(log n + 255) per query,
+for texts of ~1e9 letters
+Centers: c in [0, 2n - 1), even c is the letter c / 2, odd c the gap between (c - 1) / 2 and (c + 1) / 2,
+rho[c] = radius of the longest palindrome around c in s0 # s1 # ... # s(n-1), a palindrome of center c
+spans the letters [Lc, Rc] with Lc + Rc = c, cnt[c] = number of palindromes of center c
+Parallel Manacher: the centers are cut into chunks, every chunk runs Manacher on its own part of the text
+(a palindrome may not leave the chunk) so its box never reaches outside and the mirrors are local.
+A center is final unless its palindrome touched the chunk border, those are redone in one sequential
+pass in increasing order: start from max(local value, mirror in the box of the redone centers) and expand,
+the box only moves right so the pass is O(n) (O(number of touching centers) on texts without long
+palindromes, on DNA that is ~ a few per chunk)
+Compact storage: rho is one byte per center (2 bytes per letter), rho >= 255 is stored as 255 and the real
+value goes to `big`, a sorted list of (center, rho), the values that change in the sequential pass and
+become >= 255 go to a second sorted list merged in at the end
+Count in s[l, r]: the centers are [2l, 2r], center c has cnt[c] - max(0, l - Lc, Rc - r) palindromes inside,
+for c <= l + r only l - Lc can bind, for c > l + r only Rc - r, so
+answer = sum cnt[2l, 2r] - sum_{c <= l + r, Lc < l} (l - Lc) - sum_{c > l + r, Rc > r} (Rc - r)
+the sum of cnt: prefix sums every 64 centers + at most 63 bytes per side,
+short palindromes (rho < 255) can only cross l for c < 2l + 255 (and r for c > 2r - 255): scanned,
+long ones: wavelet matrix on the Lc (and one on the Rc) of the centers in `big`, it gives the number and
+the sum of the values < x in a range of `big` (bit levels with rank directories + prefix sums per level,
+so ~ 16 (H + 1) bytes per center in `big`: almost none on DNA, every center on aaaa...)
+count(queries): the queries are split between the threads
+Complexity: O(n / threads + touching centers) build, O(log n + 255) per query
+0-indexed, l and r inclusive
+*/
+using ll = long long;
+using ull = unsigned long long;
+struct BitRank {
+  vector<ull> w;
+  vector<ll> blk; // ones in the words before every group of 4
+  void init(ll k) {
+    w.assign((k >> 6) + 1, 0);
+  }
+  void set(ll i) {
+    w[i >> 6] |= 1ULL << (i & 63);
+  }
+  void build() {
+    blk.assign(w.size() / 4 + 2, 0);
+    ll c = 0;
+    for (size_t i = 0; i < w.size(); i++) {
+      if (i % 4 == 0) blk[i / 4] = c;
+      c += __builtin_popcountll(w[i]);
+    }
+  }
+  // ones in [0, i)
+  ll rank(ll i) const {
+    ll q = i >> 6, r = blk[q >> 2];
+    for (ll j = q & ~3LL; j < q; j++) r += __builtin_popcountll(w[j]);
+    if (i & 63) r += __builtin_popcountll(w[q] & ((1ULL << (i & 63)) - 1));
+    return r;
+  }
+};
+struct WaveletSum {
+  int H = 0;
+  vector<BitRank> b;
+  vector<ll> z;
+  vector<vector<ll>> s; // s[0]: prefix sums of the input, s[h + 1]: of the order after level h
+  WaveletSum() {}
+  WaveletSum(vector<ll> v) {
+    ll k = v.size(), mx = 0;
+    for (ll x : v) mx = max(mx, x);
+    while ((1LL << H) <= mx) H++;
+    b.resize(H), z.resize(H), s.assign(H + 1, vector<ll>(k + 1, 0));
+    for (ll i = 0; i < k; i++) s[0][i + 1] = s[0][i] + v[i];
+    vector<ll> nxt(k);
+    for (int h = 0; h < H; h++) {
+      int bit = H - 1 - h;
+      b[h].init(k);
+      z[h] = 0;
+      for (ll i = 0; i < k; i++) {
+        if (v[i] >> bit & 1) b[h].set(i);
+        else z[h]++;
+      }
+      b[h].build();
+      ll p0 = 0, p1 = z[h];
+      for (ll i = 0; i < k; i++) nxt[v[i] >> bit & 1 ? p1++ : p0++] = v[i];
+      swap(v, nxt);
+      for (ll i = 0; i < k; i++) s[h + 1][i + 1] = s[h + 1][i] + v[i];
+    }
+  }
+  ll sum(ll a, ll e) const {
+    return s[0][e] - s[0][a];
+  }
+  // number and sum of the values < x at the positions [a, e)
+  pair<ll, ll> less(ll a, ll e, ll x) const {
+    if (x <= 0 || a >= e) return {0, 0};
+    if (x >= (1LL << H)) return {e - a, sum(a, e)};
+    ll cnt = 0, sm = 0;
+    for (int h = 0; h < H; h++) {
+      ll a1 = b[h].rank(a), e1 = b[h].rank(e), a0 = a - a1, e0 = e - e1;
+      if (x >> (H - 1 - h) & 1) {
+        cnt += e0 - a0, sm += s[h + 1][e0] - s[h + 1][a0];
+        a = z[h] + a1, e = z[h] + e1;
+      } else a = a0, e = e0;
+    }
+    return {cnt, sm};
+  }
+};
+struct PalindromeIndex {
+  static constexpr int CAP = 255;
+  string_view s;
+  ll n, m, chunk; // centers per chunk of the parallel pass
+  int threads;
+  vector<unsigned char> r8;
+  vector<pair<ll, ll>> big; // (center, rho) for rho >= CAP, by center
+  vector<ll> pre; // pre[b] = sum of cnt over the centers [0, 64 b)
+  WaveletSum wl, wr;
+  template<typename F>
+  void parallel_for(ll cnt, F f) {
+    if (threads == 1 || cnt <= 1) {
+      for (ll i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<ll> nxt(0);
+    vector<thread> pool;
+    for (int t = 0; t < (int)min<ll>(threads, cnt); t++) {
+      pool.emplace_back([&]() {
+        for (ll i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+  static ll find(const vector<pair<ll, ll>> &v, ll c) {
+    auto it = lower_bound(v.begin(), v.end(), make_pair(c, LLONG_MIN));
+    return it != v.end() && it->first == c ? it->second : -1;
+  }
+  ll rho(ll c) const {
+    return r8[c] < CAP ? r8[c] : find(big, c);
+  }
+  static ll length(ll c, ll r) { // letters of the longest palindrome of center c
+    return r + 1 - ((c + r) & 1);
+  }
+  static ll cnt(ll c, ll r) {
+    return (length(c, r) + 1) >> 1;
+  }
+  // T[a] == T[b] in s0 # s1 # ..., a + b is even
+  inline bool eq(ll a, ll b) const {
+    return (a & 1) || s[a >> 1] == s[b >> 1];
+  }
+  PalindromeIndex(string_view _s, int _threads = 1, ll _chunk = 1 << 20): s(_s), n(_s.size()), chunk(_chunk), threads(max(1, _threads)) {
+    m = max(0LL, 2 * n - 1);
+    r8.assign(m, 0);
+    ll K = (m + chunk - 1) / chunk;
+    vector<vector<pair<ll, ll>>> ex(K);
+    vector<vector<ll>> touch(K);
+    parallel_for(K, [&](ll t) {
+      ll A = t * chunk, B = min(m, A + chunk);
+      auto get = [&](ll c) {
+        return r8[c] < CAP ? (ll)r8[c] : find(ex[t], c);
+      };
+      for (ll c = A, C = A, R = A - 1; c < B; c++) {
+        ll k = c <= R ? min(get(2 * C - c), R - c) : 0;
+        while (c - k - 1 >= A && c + k + 1 < B && eq(c - k - 1, c + k + 1)) k++;
+        r8[c] = min<ll>(k, CAP);
+        if (k >= CAP) ex[t].push_back({c, k});
+        if (c + k > R) C = c, R = c + k;
+        if ((c - k == A && A > 0) || (c + k == B - 1 && B < m)) touch[t].push_back(c);
+      }
+    });
+    for (auto &v : ex) big.insert(big.end(), v.begin(), v.end()), vector<pair<ll, ll>>().swap(v);
+    vector<pair<ll, ll>> late; // new values >= CAP of the sequential pass, by center
+    auto get = [&](ll c) {
+      if (r8[c] < CAP) return (ll)r8[c];
+      ll x = find(late, c);
+      return x != -1 ? x : find(big, c);
+    };
+    for (ll t = 0, C = 0, R = -1; t < K; t++) {
+      for (ll c : touch[t]) {
+        ll k0 = get(c), k = k0;
+        if (c <= R) k = max(k, min(get(2 * C - c), R - c));
+        while (c - k - 1 >= 0 && c + k + 1 < m && eq(c - k - 1, c + k + 1)) k++;
+        if (k != k0) {
+          r8[c] = min<ll>(k, CAP);
+          if (k >= CAP) late.push_back({c, k});
+        }
+        if (c + k > R) C = c, R = c + k;
+      }
+    }
+    if (!late.empty()) {
+      vector<pair<ll, ll>> res;
+      res.reserve(big.size() + late.size());
+      size_t j = 0;
+      for (auto &x : big) {
+        while (j < late.size() && late[j].first < x.first) res.push_back(late[j++]);
+        if (j < late.size() && late[j].first == x.first) res.push_back(late[j++]);
+        else res.push_back(x);
+      }
+      while (j < late.size()) res.push_back(late[j++]);
+      big.swap(res);
+    }
+    ll nb = (m >> 6) + 1;
+    pre.assign(nb + 1, 0);
+    parallel_for((nb + 1023) / 1024, [&](ll g) {
+      for (ll b = g * 1024; b < min(nb, g * 1024 + 1024); b++) {
+        ll sm = 0;
+        for (ll c = b << 6; c < min(m, (b + 1) << 6); c++) sm += cnt(c, rho(c));
+        pre[b + 1] = sm;
+      }
+    });
+    for (ll b = 0; b < nb; b++) pre[b + 1] += pre[b];
+    vector<ll> L(big.size()), R(big.size());
+    for (size_t i = 0; i < big.size(); i++) {
+      ll c = big[i].first, len = length(c, big[i].second);
+      L[i] = (c - len + 1) >> 1, R[i] = (c + len - 1) >> 1;
+    }
+    wl = WaveletSum(L), wr = WaveletSum(R);
+  }
+  // sum of cnt over the centers [0, x)
+  ll prefix(ll x) const {
+    ll res = pre[x >> 6];
+    for (ll c = x & ~63LL; c < x; c++) res += cnt(c, rho(c));
+    return res;
+  }
+  bool is_palindrome(ll l, ll r) const {
+    return length(l + r, rho(l + r)) >= r - l + 1;
+  }
+  // number of palindromic substrings of s[l, r]
+  ll count(ll l, ll r) const {
+    if (l > r) return 0;
+    ll a = 2 * l, e = 2 * r, mid = l + r;
+    ll res = prefix(e + 1) - prefix(a);
+    for (ll c = a; c <= min(mid, a + CAP); c++) if (r8[c] < CAP) {
+      ll Lc = (c - length(c, r8[c]) + 1) >> 1;
+      if (Lc < l) res -= l - Lc;
+    }
+    for (ll c = max(mid + 1, e - CAP); c <= e; c++) if (r8[c] < CAP) {
+      ll Rc = (c + length(c, r8[c]) - 1) >> 1;
+      if (Rc > r) res -= Rc - r;
+    }
+    auto pos = [&](ll c) { // first index of big with center > c
+      return upper_bound(big.begin(), big.end(), make_pair(c, LLONG_MAX)) - big.begin();
+    };
+    ll i0 = pos(a - 1), i1 = pos(mid), i2 = pos(e);
+    auto [cl, sl] = wl.less(i0, i1, l);
+    res -= cl * l - sl;
+    auto [cr, sr] = wr.less(i1, i2, r + 1);
+    res -= (wr.sum(i1, i2) - sr) - (i2 - i1 - cr) * r;
+    return res;
+  }
+  vector<ll> count(const vector<pair<ll, ll>> &q) {
+    vector<ll> res(q.size());
+    parallel_for((q.size() + 1023) / 1024, [&](ll g) {
+      for (size_t i = g * 1024; i < min(q.size(), (size_t)g * 1024 + 1024); i++) res[i] = count(q[i].first, q[i].second);
+    });
+    return res;
+  }
+  size_t memory_usage() const {
+    size_t res = r8.capacity() + big.capacity() * sizeof(pair<ll, ll>) + pre.capacity() * sizeof(ll);
+    for (auto *w : {&wl, &wr}) {
+      for (auto &x : w->b) res += x.w.capacity() * sizeof(ull) + x.blk.capacity() * sizeof(ll);
+      for (auto &x : w->s) res += x.capacity() * sizeof(ll);
+    }
+    return res;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  string s;
+  int q;
+  cin >> s >> q;
+  PalindromeIndex P(s, thread::hardware_concurrency());
+  vector<pair<ll, ll>> qs(q);
+  for (auto &[l, r] : qs) cin >> l >> r, l--, r--;
+  for (ll x : P.count(qs)) cout << x << '\n';
+  return 0;
+}
+// https://codeforces.com/contest/245/problem/H
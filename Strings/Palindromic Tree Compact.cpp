@@ -0,0 +1,186 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Palindromic tree (eertree) without an int[26] per node, for streams of ~1e8 letters
+K > 0: letters in [0, K), every node has a row of K ints in one pool (DNA: 16 bytes)
+K = 0: letters are bytes, the children of a node are a list: first child + next sibling + the letter on the
+edge into the node, a node has exactly one parent so that is 9 bytes per node whatever the alphabet is,
+a lookup scans the children (at most sigma of them, few in practice)
+All the node fields are separate arrays (len, link, ...), a node is 16 bytes + its transitions
+The text is kept as 1 byte per letter (the links look back at any position), append() takes string_view
+chunks so a stream can be fed piece by piece
+Node 0 is the root of length -1, node 1 the root of length 0, link[v] < v so the reverse order of creation
+is a topological order of the links (occurrences() needs no sort)
+diff(v) = len(v) - len(link(v)), slink(v) = the longest palindromic suffix u of v with diff(u) != diff(v),
+the palindromic suffixes of a prefix split into O(log n) runs of equal diff along slink
+PalFactorDP<S>: dp[i] = sum over the palindromic suffixes p of s[0, i) of piece(dp[i - |p|]) in a semiring S
+(plus, zero = no factorization, one = empty factorization, piece = append one palindrome, it must
+distribute over plus), with the series links a run is summed in O(1) from the run of link(v), which was
+stored at position i - diff(v), so a letter costs O(log n) semiring operations
+MinFactor: fewest palindromes, CountFactor: number of factorizations mod p, ParityFactor: fewest with an
+even / odd number of pieces, s[0, i) splits into exactly k palindromes iff k <= i and k >= dp[i][k & 1]
+(a piece of length >= 3 splits into 3, two pieces of length 2 into 4, so k + 2 also works)
+Complexity: O(n) amortized nodes / link walks (O(n sigma) lookups worst case for K = 0), O(n log n) for the DP
+0-indexed, dp[i] is for the prefix of length i
+*/
+template<int K = 0>
+struct EertreeCompact {
+  int sz, last, n;
+  vector<unsigned char> s;
+  vector<int> len, link, slink, oc;
+  // K > 0
+  vector<int> row;
+  // K = 0
+  vector<int> fst, sib;
+  vector<unsigned char> chr;
+  EertreeCompact() {
+    sz = 0, n = 0;
+    new_node(-1), new_node(0);
+    link[0] = link[1] = 0;
+    slink[0] = 0, slink[1] = 1;
+    last = 1;
+  }
+  // for a text of about m letters, the nodes grow on demand (at most m + 2 of them, usually far fewer:
+  // 2e7 random DNA letters have ~17000 distinct palindromes)
+  void reserve(long long m) {
+    s.reserve(m);
+  }
+  int new_node(int l) {
+    len.push_back(l), link.push_back(0), slink.push_back(0), oc.push_back(0);
+    if (K) row.resize(row.size() + K, -1);
+    else fst.push_back(-1), sib.push_back(-1), chr.push_back(0);
+    return sz++;
+  }
+  inline int get(int v, int c) const {
+    if constexpr (K > 0) return row[(long long)v * K + c];
+    for (int u = fst[v]; u != -1; u = sib[u]) if (chr[u] == c) return u;
+    return -1;
+  }
+  void set(int v, int c, int to) {
+    if constexpr (K > 0) {
+      row[(long long)v * K + c] = to;
+      return;
+    }
+    chr[to] = c, sib[to] = fst[v], fst[v] = to;
+  }
+  inline int diff(int v) const {
+    return v < 2 ? 0 : len[v] - len[link[v]];
+  }
+  // first palindromic suffix on the link path of v that c extends: the letter before it is c
+  int find(int v, int c) const {
+    while (n - 2 - len[v] < 0 || s[n - 2 - len[v]] != c) v = link[v];
+    return v;
+  }
+  // returns true if it creates a new palindrome
+  bool extend(int c) {
+    s.push_back(c), n++;
+    int cur = find(last, c), v = get(cur, c);
+    if (v != -1) {
+      last = v, oc[v]++;
+      return false;
+    }
+    v = new_node(len[cur] + 2);
+    link[v] = len[v] == 1 ? 1 : get(find(link[cur], c), c);
+    set(cur, c, v); // after the link: a new node is never its own link
+    slink[v] = diff(v) == diff(link[v]) ? slink[link[v]] : link[v];
+    last = v, oc[v]++;
+    return true;
+  }
+  // appends a chunk of the stream, letter = byte - base
+  void append(string_view t, int base = 0) {
+    for (unsigned char c : t) extend(c - base);
+  }
+  // number of occurrences of every palindrome (node)
+  vector<long long> occurrences() const {
+    vector<long long> res(oc.begin(), oc.end());
+    for (int v = sz - 1; v >= 2; v--) res[link[v]] += res[v];
+    return res;
+  }
+  // number of palindromic substrings counted with multiplicity
+  long long count_all() const {
+    auto res = occurrences();
+    return accumulate(res.begin() + 2, res.end(), 0LL);
+  }
+  template<typename T>
+  static size_t bytes(const vector<T> &a) {
+    return a.capacity() * sizeof(T);
+  }
+  size_t memory_usage() const {
+    return bytes(s) + bytes(len) + bytes(link) + bytes(slink) + bytes(oc) + bytes(row) + bytes(fst) + bytes(sib) + bytes(chr);
+  }
+  void report(ostream &os) const {
+    os << "nodes " << sz << ", letters " << n << ", " << memory_usage() / 1048576.0 << " MB, "
+       << (double)memory_usage() / max(1, n) << " bytes per letter\n";
+  }
+};
+struct MinFactor {
+  using T = int;
+  static const T INF = 1e9;
+  static T zero() { return INF; }
+  static T one() { return 0; }
+  static T plus(T a, T b) { return min(a, b); }
+  static T piece(T a) { return a < INF ? a + 1 : INF; }
+};
+template<int P = 1000000007>
+struct CountFactor {
+  using T = int;
+  static T zero() { return 0; }
+  static T one() { return 1; }
+  static T plus(T a, T b) { return a + b >= P ? a + b - P : a + b; }
+  static T piece(T a) { return a; }
+};
+struct ParityFactor {
+  using T = array<int, 2>; // fewest pieces with an even / odd count
+  static const int INF = 1e9;
+  static T zero() { return {INF, INF}; }
+  static T one() { return {0, INF}; }
+  static T plus(T a, T b) { return {min(a[0], b[0]), min(a[1], b[1])}; }
+  static T piece(T a) { return {MinFactor::piece(a[1]), MinFactor::piece(a[0])}; }
+  // the prefix of length i splits into exactly k palindromes
+  static bool can(const T &a, long long i, long long k) { return k <= i && a[k & 1] <= k; }
+};
+template<typename S>
+struct PalFactorDP {
+  using T = typename S::T;
+  vector<T> dp, ser; // ser[v]: sum over the run of v, for the last position where v was on the chain
+  PalFactorDP() : dp(1, S::one()) {}
+  void reserve(long long m) {
+    dp.reserve(m + 1);
+  }
+  // call after every extend() of t
+  template<int K>
+  void step(const EertreeCompact<K> &t) {
+    int i = t.n;
+    if ((int)ser.size() < t.sz) ser.resize(t.sz, S::zero());
+    T cur = S::zero();
+    for (int v = t.last; t.len[v] > 0; v = t.slink[v]) {
+      int d = t.diff(v);
+      ser[v] = dp[i - (t.len[t.slink[v]] + d)];
+      if (d == t.diff(t.link[v])) ser[v] = S::plus(ser[v], ser[t.link[v]]);
+      cur = S::plus(cur, S::piece(ser[v]));
+    }
+    dp.push_back(cur);
+  }
+  template<int K>
+  void append(EertreeCompact<K> &t, string_view s, int base = 0) {
+    for (unsigned char c : s) {
+      t.extend(c - base);
+      step(t);
+    }
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  string s;
+  cin >> s;
+  EertreeCompact<26> t;
+  t.reserve(s.size());
+  PalFactorDP<MinFactor> dp;
+  dp.reserve(s.size());
+  dp.append(t, s, 'a');
+  cout << t.count_all() << '\n'; // number of palindromes
+  cout << dp.dp[s.size()] << '\n'; // minimum palindromic factorization
+  return 0;
+}
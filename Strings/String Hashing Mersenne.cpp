@@ -0,0 +1,164 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Polynomial hashing with one modulus 2^61 - 1, h(s[l, r)) = s[l] B^(r - l - 1) + ... + s[r - 1]
+a * b mod 2^61 - 1 is one 64 x 64 -> 128 bit multiply + shift / mask / add, the base is random per run
+so a collision has probability ~ n / 2^61 per comparison (no anti-hash test can target it)
+Powers: one table shared by all the hashes, grown (doubling) when a longer string shows up, no N limit,
+call Pow::reserve(n) first if several threads hash at the same time
+Hash keeps only the n + 1 prefix hashes of a string_view (the text is not copied), get(l, r) in O(1):
+h[r] - h[l] * B^(r - l), no inverse powers needed
+Prefix build: the prefix chain is one multiply per letter, so it is done in blocks of 8: the hashes of the
+block's own prefixes do not depend on the previous blocks and h[i + k] = h[i] B^k + q[k] for the 8 of them
+only waits for h[i], the 8 multiplies of a block are independent (about the speed of the plain loop when
+the multiplier is the bottleneck, faster on cores with more than one)
+Rolling: the hash of the last w letters of a stream, the w letters are kept in a ring
+lcp: gallop (lengths 1, 2, 4, ...) then binary search, so O(log lcp)
+lcp_batch: the searches of many pairs run in lock step, every round touches the prefix hashes of all the
+pairs one after the other (and prefetches them) so the cache misses of different pairs overlap
+Complexity: O(n) build, O(1) get, O(log lcp) per lcp
+0-indexed, get(l, r) is the hash of s[l, r)
+*/
+using u64 = unsigned long long;
+const u64 MOD = (1ULL << 61) - 1;
+inline u64 mul(u64 a, u64 b) {
+  __uint128_t c = (__uint128_t)a * b;
+  u64 r = (u64)(c & MOD) + (u64)(c >> 61);
+  return r >= MOD ? r - MOD : r;
+}
+inline u64 add(u64 a, u64 b) {
+  a += b;
+  return a >= MOD ? a - MOD : a;
+}
+inline u64 sub(u64 a, u64 b) {
+  return a >= b ? a - b : a + MOD - b;
+}
+struct Pow {
+  inline static u64 B = (u64)chrono::steady_clock::now().time_since_epoch().count() % (MOD - 1024) + 512;
+  inline static vector<u64> pw = {1};
+  static void reserve(size_t n) {
+    if (pw.size() > n) return;
+    size_t k = pw.size();
+    pw.resize(max(n + 1, 2 * k));
+    for (size_t i = k; i < pw.size(); i++) pw[i] = mul(pw[i - 1], B);
+  }
+  static u64 get(size_t k) {
+    reserve(k);
+    return pw[k];
+  }
+};
+struct Hash {
+  int n;
+  vector<u64> h;
+  Hash() {}
+  Hash(string_view s): n(s.size()), h(s.size() + 1) {
+    Pow::reserve(8);
+    const u64 *pw = Pow::pw.data();
+    h[0] = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+      u64 q[8], x = 0;
+      for (int k = 0; k < 8; k++) q[k] = x = add(mul(x, Pow::B), (unsigned char)s[i + k] + 1);
+      for (int k = 0; k < 8; k++) h[i + k + 1] = add(mul(h[i], pw[k + 1]), q[k]);
+    }
+    for (; i < n; i++) h[i + 1] = add(mul(h[i], Pow::B), (unsigned char)s[i] + 1);
+    Pow::reserve(n);
+  }
+  u64 get(int l, int r) const {
+    return sub(h[r], mul(h[l], Pow::pw[r - l]));
+  }
+  u64 get() const {
+    return h[n];
+  }
+  // longest common prefix of the suffixes i and j
+  int lcp(int i, int j) const {
+    int lo = 0, hi = n - max(i, j);
+    for (int len = 1; len <= hi; len <<= 1) { // gallop first, most lcps are short
+      if (get(i, i + len) != get(j, j + len)) {
+        hi = len - 1;
+        break;
+      }
+      lo = len;
+    }
+    while (lo < hi) {
+      int mid = (lo + hi + 1) >> 1;
+      if (get(i, i + mid) == get(j, j + mid)) lo = mid;
+      else hi = mid - 1;
+    }
+    return lo;
+  }
+  // res[k] = lcp(q[k].first, q[k].second)
+  void lcp_batch(const vector<pair<int, int>> &q, vector<int> &res) const {
+    int m = q.size();
+    res.resize(m);
+    // gal[k] > 0: next length of the gallop, 0: binary search on [lo, hi]
+    vector<int> lo(m, 0), hi(m), gal(m, 1);
+    for (int k = 0; k < m; k++) hi[k] = n - max(q[k].first, q[k].second);
+    const int G = 64;
+    for (int g = 0; g < m; g += G) {
+      int e = min(m, g + G);
+      auto next = [&](int k) {
+        return gal[k] ? gal[k] : (lo[k] + hi[k] + 1) >> 1;
+      };
+      for (bool busy = true; busy; ) {
+        busy = false;
+        for (int k = g; k < e; k++) if (lo[k] < hi[k]) {
+          int len = next(k);
+          __builtin_prefetch(&h[q[k].first + len]);
+          __builtin_prefetch(&h[q[k].second + len]);
+        }
+        for (int k = g; k < e; k++) if (lo[k] < hi[k]) {
+          int len = next(k), i = q[k].first, j = q[k].second;
+          bool eq = get(i, i + len) == get(j, j + len);
+          if (gal[k]) {
+            if (eq) lo[k] = len, gal[k] = 2 * len <= hi[k] ? 2 * len : 0;
+            else hi[k] = len - 1, gal[k] = 0;
+          } else if (eq) lo[k] = len;
+          else hi[k] = len - 1;
+          busy |= lo[k] < hi[k];
+        }
+      }
+      for (int k = g; k < e; k++) res[k] = lo[k];
+    }
+  }
+};
+// hash of the last w letters of a stream
+struct Rolling {
+  int w, cnt = 0, pos = 0;
+  u64 h = 0, top;
+  vector<unsigned char> ring;
+  Rolling(int _w): w(_w), top(Pow::get(_w)), ring(_w) {}
+  void push(char ch) {
+    unsigned char c = ch;
+    h = add(mul(h, Pow::B), c + 1);
+    if (cnt == w) h = sub(h, mul(top, ring[pos] + 1));
+    else cnt++;
+    ring[pos] = c;
+    if (++pos == w) pos = 0;
+  }
+  bool full() const {
+    return cnt == w;
+  }
+  u64 get() const {
+    return h;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int n;
+  while (cin >> n) {
+    string s, p;
+    cin >> p >> s;
+    u64 hp = Hash(p).get();
+    Rolling R(n);
+    for (int i = 0; i < (int)s.size(); i++) {
+      R.push(s[i]);
+      if (R.full() && R.get() == hp) cout << i - n + 1 << '\n';
+    }
+    cout << '\n';
+  }
+  return 0;
+}
+// https://www.spoj.com/problems/NHAY/
@@ -0,0 +1,208 @@
+#pragma GCC optimize("O3")
+#pragma GCC target("sse,sse2,sse3,ssse3,sse4,popcnt,abm,mmx,avx,avx2,fma")
+#pragma GCC optimize("unroll-loops")
+
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Substring search on string_view: nothing is copied, the texts and patterns are only viewed
+prefix_function / z_function: same as KMP.cpp and Z Algorithm.cpp but on a string_view and into a
+caller's vector (its memory is reused from call to call)
+Searcher (one pattern), first / last letter filter: for a block of 64 positions a byte flag
+(t[i] == p[0]) & (t[i + m - 1] == p[m - 1]) is computed, that loop is plain byte compares so the compiler
+makes it 32 positions per AVX2 instruction, then the flags are read 8 at a time and only the candidates are
+compared with memcmp (first 16 bytes, then the rest). The bytes given to memcmp are counted, when they pass
+4 times the scanned positions (aaaa... for aaab, or a periodic text with long near misses) the rest of the
+text is done by KMP, so the filter spends O(n + m) before that and the worst case stays O(n + m)
+MultiSearch (many short patterns, one pass over the text): the patterns are bucketed on their first 2 bytes
+(65536 buckets + a bit per non empty bucket, patterns of 1 byte in their own 256 buckets), in a bucket every
+pattern keeps its first 8 bytes as a masked word so most checks are one 8 byte load + compare
+Complexity: Searcher O(n + m) worst, ~n / 32 compares + candidates on usual texts, MultiSearch O(n + checks)
+0-indexed, the callbacks get the starting position of the occurrence
+*/
+void prefix_function(string_view p, vector<int> &pi) {
+  int m = p.size();
+  pi.assign(m, 0);
+  for (int i = 1, j = 0; i < m; i++) {
+    while (j && p[i] != p[j]) j = pi[j - 1];
+    if (p[i] == p[j]) j++;
+    pi[i] = j;
+  }
+}
+void z_function(string_view s, vector<int> &z) {
+  int n = s.size();
+  z.assign(n, 0);
+  for (int i = 1, l = 0, r = 0; i < n; ++i) {
+    if (i <= r) z[i] = min(r - i + 1, z[i - l]);
+    while (i + z[i] < n && s[z[i]] == s[i + z[i]]) ++z[i];
+    if (i + z[i] - 1 > r) l = i, r = i + z[i] - 1;
+  }
+}
+// f(pos) for the occurrences of p in t[from, n) with pi = prefix_function(p), f returns false to stop
+template<typename F>
+size_t kmp_search(string_view t, string_view p, const vector<int> &pi, size_t from, F f) {
+  size_t m = p.size(), j = 0, cnt = 0;
+  for (size_t i = from; i < t.size(); i++) {
+    while (j && t[i] != p[j]) j = pi[j - 1];
+    if (t[i] == p[j]) j++;
+    if (j == m) {
+      cnt++;
+      if (!f(i + 1 - m)) break;
+      j = pi[j - 1];
+    }
+  }
+  return cnt;
+}
+struct Searcher {
+  string_view p;
+  vector<int> pi;
+  Searcher() {}
+  Searcher(string_view _p): p(_p) {
+    prefix_function(p, pi);
+  }
+  // f(pos) for every occurrence in increasing order, f returns false to stop, returns the number of calls
+  template<typename F>
+  size_t find_all(string_view t, F f) const {
+    size_t n = t.size(), m = p.size(), cnt = 0;
+    if (!m || m > n) return 0;
+    const unsigned char *s = (const unsigned char *)t.data();
+    const unsigned char a = p[0], b = p[m - 1];
+    size_t i = 0, work = 0, head = m > 2 ? min<size_t>(m - 2, 16) : 0;
+    alignas(64) unsigned char hit[64];
+    for (; i + 64 + m - 1 <= n; i += 64) {
+      for (int k = 0; k < 64; k++) hit[k] = (s[i + k] == a) & (s[i + k + m - 1] == b);
+      for (int w = 0; w < 64; w += 8) {
+        unsigned long long x;
+        memcpy(&x, hit + w, 8);
+        while (x) {
+          size_t pos = i + w + (__builtin_ctzll(x) >> 3);
+          x &= x - 1;
+          // the first 16 bytes, then the rest, work counts the bytes given to memcmp
+          bool eq = m <= 2 || !memcmp(s + pos + 1, p.data() + 1, head);
+          work += head;
+          if (eq && m > head + 2) {
+            eq = !memcmp(s + pos + 1 + head, p.data() + 1 + head, m - 2 - head);
+            work += m - 2 - head;
+          }
+          if (eq) {
+            cnt++;
+            if (!f(pos)) return cnt;
+          }
+          if (work > 4 * (pos + 64)) return cnt + kmp_search(t, p, pi, pos + 1, f); // the filter does not work here
+        }
+      }
+    }
+    for (; i + m <= n; i++) {
+      if (s[i] == a && s[i + m - 1] == b && !memcmp(s + i, p.data(), m)) {
+        cnt++;
+        if (!f(i)) return cnt;
+      }
+    }
+    return cnt;
+  }
+  size_t find(string_view t) const {
+    size_t res = string_view::npos;
+    find_all(t, [&](size_t pos) {
+      res = pos;
+      return false;
+    });
+    return res;
+  }
+  size_t count(string_view t) const {
+    return find_all(t, [](size_t) {
+      return true;
+    });
+  }
+};
+struct MultiSearch {
+  using ull = unsigned long long;
+  struct Pat {
+    ull pre, mask;
+    int len, id;
+  };
+  vector<string_view> pats;
+  vector<int> st, st1; // buckets in CSR: 2 bytes and 1 byte
+  vector<Pat> bk, bk1;
+  vector<ull> nonempty;
+  int add_pattern(string_view p) {
+    pats.push_back(p);
+    return pats.size() - 1;
+  }
+  static Pat make(string_view p, int id) {
+    Pat x = {0, 0, (int)p.size(), id};
+    int k = min<int>(8, p.size());
+    memcpy(&x.pre, p.data(), k);
+    x.mask = k == 8 ? ~0ULL : (1ULL << (8 * k)) - 1;
+    return x;
+  }
+  void build() {
+    st.assign(65537, 0), st1.assign(257, 0);
+    nonempty.assign(1024, 0);
+    auto key = [&](string_view p) {
+      return (unsigned char)p[0] | (unsigned char)p[1] << 8;
+    };
+    for (auto &p : pats) {
+      if (p.size() >= 2) st[key(p) + 1]++;
+      else if (p.size() == 1) st1[(unsigned char)p[0] + 1]++;
+    }
+    for (int i = 0; i < 65536; i++) st[i + 1] += st[i];
+    for (int i = 0; i < 256; i++) st1[i + 1] += st1[i];
+    bk.resize(st[65536]), bk1.resize(st1[256]);
+    vector<int> pos(st.begin(), st.end() - 1), pos1(st1.begin(), st1.end() - 1);
+    for (int i = 0; i < (int)pats.size(); i++) {
+      auto &p = pats[i];
+      if (p.size() >= 2) {
+        int k = key(p);
+        bk[pos[k]++] = make(p, i);
+        nonempty[k >> 6] |= 1ULL << (k & 63);
+      } else if (p.size() == 1) bk1[pos1[(unsigned char)p[0]]++] = make(p, i);
+    }
+  }
+  // f(id, pos) for every occurrence of every pattern, by increasing pos
+  template<typename F>
+  size_t find_all(string_view t, F f) const {
+    size_t n = t.size(), cnt = 0;
+    const unsigned char *s = (const unsigned char *)t.data();
+    for (size_t i = 0; i < n; i++) {
+      int c = s[i];
+      for (int j = st1[c]; j < st1[c + 1]; j++) f(bk1[j].id, i), cnt++;
+      if (i + 1 == n) break;
+      int k = c | s[i + 1] << 8;
+      if (!(nonempty[k >> 6] >> (k & 63) & 1)) continue;
+      ull w = 0;
+      memcpy(&w, s + i, min<size_t>(8, n - i));
+      for (int j = st[k]; j < st[k + 1]; j++) {
+        const Pat &x = bk[j];
+        if ((w & x.mask) != x.pre || i + x.len > n) continue;
+        if (x.len > 8 && memcmp(s + i + 8, pats[x.id].data() + 8, x.len - 8)) continue;
+        f(x.id, i), cnt++;
+      }
+    }
+    return cnt;
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int t;
+  cin >> t;
+  while (t--) {
+    string s, p;
+    cin >> s >> p;
+    Searcher S(p);
+    vector<size_t> ans;
+    S.find_all(s, [&](size_t pos) {
+      ans.push_back(pos);
+      return true;
+    });
+    if (ans.empty()) cout << "Not Found\n";
+    else {
+      cout << ans.size() << '\n';
+      for (auto x : ans) cout << x << ' ';
+      cout << '\n';
+    }
+    cout << '\n';
+  }
+  return 0;
+}
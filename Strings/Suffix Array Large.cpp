@@ -0,0 +1,391 @@
+#include<bits/stdc++.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+using namespace std;
+
+/*
+Suffix array + LCP for byte strings of a few GB, sized at runtime
+Index type: uint32_t (texts < 2^32 - 1) or uint40 (5 bytes per entry, texts < 2^40 - 1)
+SA-IS (Nong, Zhang, Chan) on the bytes themselves: the text is never widened, the sentinel is virtual
+(letter c is read as c + 1 and position n as 0), the reduced string is stored in the free tail of SA and
+the recursion works on it in place, the L / S types are one bit per letter
+Memory: the text + (n + 1) indices + n / 8 bytes, the recursion adds a bucket array of at most n / 2 indices
+(usually far less), against ~20n bytes of Suffix Array.cpp (int text, int SA, sparse table of LCP)
+Parallel parts: the induced sorts are sequential scans but most of their time goes to the random reads of
+the letter and the type of SA[i] - 1, so SA is scanned in blocks and those reads are done for a whole
+block by the threads first (an entry written inside the current block during the scan is read directly),
+the comparisons of the LMS substrings for the naming, and the Φ / PLCP / LCP passes are split between threads
+LCP with Φ: phi[sa[r]] = sa[r - 1], PLCP[i] = lcp(i, phi[i]) in text order with PLCP[i + 1] >= PLCP[i] - 1,
+in place in one array, the text is cut into one contiguous range per thread and every range starts from
+h = 0, so O(n + threads * max lcp) (O(n) with one thread)
+Sparse PLCP: only PLCP[i] for i % q == 0 (n / q indices), lcp(r) extends from PLCP[i - i % q] - i % q
+The arrays are mmaps: anonymous memory, or a file (created with the given path) so the result stays on disk
+Complexity: O(n) for SA, O(n + threads * max lcp) for the (sparse) PLCP and LCP,
+O(q + lcp - PLCP lower bound) per query
+0-indexed, sa[r] = start of the r-th smallest suffix, lcp[r] = lcp(sa[r - 1], sa[r]), lcp[0] = 0
+*/
+using u64 = unsigned long long;
+struct uint40 {
+  uint32_t lo;
+  uint8_t hi;
+  uint40() {}
+  uint40(u64 x): lo(x), hi(x >> 32) {}
+  operator u64() const {
+    return (u64)hi << 32 | lo;
+  }
+} __attribute__((packed));
+static_assert(sizeof(uint40) == 5, "");
+
+template<typename T>
+struct MappedArray {
+  T *a = nullptr;
+  u64 n = 0;
+  size_t len = 0;
+  int fd = -1;
+  MappedArray() {}
+  MappedArray(const MappedArray &) = delete;
+  MappedArray &operator=(const MappedArray &) = delete;
+  ~MappedArray() {
+    release();
+  }
+  static size_t bytes(u64 k) {
+    return max<u64>(1, k) * sizeof(T);
+  }
+  // path = "": anonymous memory, otherwise the file is created (or truncated) and mapped shared
+  bool create(u64 k, const string &path = "") {
+    release();
+    void *p;
+    if (path.empty()) p = mmap(nullptr, bytes(k), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    else {
+      fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+      if (fd < 0 || ftruncate(fd, bytes(k))) return release(), false;
+      p = mmap(nullptr, bytes(k), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (p == MAP_FAILED) return release(), false;
+    a = (T *)p, n = k, len = bytes(k);
+    return true;
+  }
+  // maps an existing file read only, n = size / sizeof(T)
+  bool open(const string &path) {
+    release();
+    struct stat sb;
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0 || fstat(fd, &sb)) return release(), false;
+    void *p = mmap(nullptr, bytes(sb.st_size / sizeof(T)), PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) return release(), false;
+    a = (T *)p, n = sb.st_size / sizeof(T), len = bytes(n);
+    return true;
+  }
+  // keeps the first k entries, the file is truncated
+  void shrink(u64 k) {
+    if (k >= n) return;
+    n = k;
+    if (fd < 0) return;
+    munmap(a, len);
+    if (ftruncate(fd, bytes(k))) {}
+    len = bytes(k);
+    a = (T *)mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  void release() {
+    if (a) munmap(a, len);
+    if (fd >= 0) close(fd);
+    a = nullptr, n = 0, len = 0, fd = -1;
+  }
+  T &operator[](u64 i) {
+    return a[i];
+  }
+  const T &operator[](u64 i) const {
+    return a[i];
+  }
+};
+
+template<typename I = uint32_t>
+struct SuffixArrayLarge {
+  static constexpr u64 EMPTY = (1ULL << (8 * sizeof(I))) - 1, SKIP = EMPTY - 1;
+  static constexpr u64 B = 1 << 18; // block of the induced sorts
+  const unsigned char *s;
+  u64 n;
+  int threads;
+  MappedArray<I> sa, plcp;
+  int q = 0;
+  vector<I> sp; // sparse PLCP
+  SuffixArrayLarge(const unsigned char *_s, u64 _n, int _threads = 1): s(_s), n(_n), threads(max(1, _threads)) {}
+  template<typename F>
+  void parallel_for(u64 cnt, F f) {
+    if (threads == 1 || cnt <= 1) {
+      for (u64 i = 0; i < cnt; i++) f(i);
+      return;
+    }
+    atomic<u64> nxt(0);
+    vector<thread> pool;
+    for (int t = 0; t < (int)min<u64>(threads, cnt); t++) {
+      pool.emplace_back([&]() {
+        for (u64 i; (i = nxt++) < cnt; ) f(i);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+  // the text with the virtual sentinel, length n + 1
+  struct Text {
+    const unsigned char *s;
+    u64 n;
+    u64 operator[](u64 i) const {
+      return i < n ? s[i] + 1 : 0;
+    }
+  };
+  struct Reduced {
+    const I *s;
+    u64 operator[](u64 i) const {
+      return s[i];
+    }
+  };
+  struct Types {
+    vector<u64> b;
+    bool operator[](u64 i) const { // 1 = S type
+      return b[i >> 6] >> (i & 63) & 1;
+    }
+    bool lms(u64 i) const {
+      return i && (*this)[i] && !(*this)[i - 1];
+    }
+  };
+  template<typename S>
+  static void buckets(const S &str, u64 m, u64 K, I *bkt, bool end) {
+    for (u64 c = 0; c < K; c++) bkt[c] = 0;
+    for (u64 i = 0; i < m; i++) bkt[str[i]] = (u64)bkt[str[i]] + 1;
+    u64 sum = 0;
+    for (u64 c = 0; c < K; c++) {
+      sum += bkt[c];
+      bkt[c] = end ? sum : sum - bkt[c];
+    }
+  }
+  // the letters of SA[i] - 1 for the block [b, e), SKIP if it is not of the induced type, EMPTY = read it later
+  template<typename S>
+  void prefetch(const S &str, const Types &t, I *SA, u64 b, u64 e, bool stype, vector<u64> &cc) {
+    const u64 CH = 1 << 14;
+    parallel_for((e - b + CH - 1) / CH, [&](u64 k) {
+      for (u64 i = b + k * CH; i < min(e, b + (k + 1) * CH); i++) {
+        u64 v = SA[i];
+        if (v == EMPTY) cc[i - b] = EMPTY;
+        else cc[i - b] = v == 0 || t[v - 1] != stype ? SKIP : str[v - 1];
+      }
+    });
+  }
+  template<typename S>
+  void induce(const S &str, const Types &t, I *SA, u64 m, u64 K, I *bkt) {
+    bool par = threads > 1 && m > 2 * B;
+    vector<u64> cc(par ? B : 0);
+    // L type, left to right from the bucket heads
+    buckets(str, m, K, bkt, false);
+    for (u64 b = 0; b < m; b += B) {
+      u64 e = min(m, b + B);
+      if (par) prefetch(str, t, SA, b, e, false, cc);
+      for (u64 i = b; i < e; i++) {
+        u64 v = SA[i], c;
+        if (v == EMPTY) continue;
+        if (par && cc[i - b] != EMPTY) {
+          if ((c = cc[i - b]) == SKIP) continue;
+        } else {
+          if (v == 0 || t[v - 1]) continue;
+          c = str[v - 1];
+        }
+        u64 p = bkt[c];
+        bkt[c] = p + 1;
+        SA[p] = v - 1;
+        if (par && p < e) cc[p - b] = EMPTY;
+      }
+    }
+    // S type, right to left from the bucket ends
+    buckets(str, m, K, bkt, true);
+    for (u64 e = m; e > 0; e -= min(e, B)) {
+      u64 b = e - min(e, B);
+      if (par) prefetch(str, t, SA, b, e, true, cc);
+      for (u64 i = e; i-- > b; ) {
+        u64 v = SA[i], c;
+        if (v == EMPTY) continue;
+        if (par && cc[i - b] != EMPTY) {
+          if ((c = cc[i - b]) == SKIP) continue;
+        } else {
+          if (v == 0 || !t[v - 1]) continue;
+          c = str[v - 1];
+        }
+        u64 p = (u64)bkt[c] - 1;
+        bkt[c] = p;
+        SA[p] = v - 1;
+        if (par && p >= b) cc[p - b] = EMPTY;
+      }
+    }
+  }
+  // str has length m, its last letter is a unique minimum, letters in [0, K)
+  template<typename S>
+  void sais(const S &str, I *SA, u64 m, u64 K) {
+    Types t;
+    t.b.assign((m + 63) >> 6, 0);
+    t.b[(m - 1) >> 6] |= 1ULL << ((m - 1) & 63);
+    for (u64 i = m - 1, cur = 1; i-- > 0; ) {
+      u64 x = str[i], y = str[i + 1];
+      cur = x < y || (x == y && cur);
+      if (cur) t.b[i >> 6] |= 1ULL << (i & 63);
+    }
+    vector<I> bkt(K);
+    // sort the LMS substrings
+    buckets(str, m, K, bkt.data(), true);
+    for (u64 i = 0; i < m; i++) SA[i] = EMPTY;
+    for (u64 i = 1; i < m; i++) if (t.lms(i)) {
+      u64 p = (u64)bkt[str[i]] - 1;
+      bkt[str[i]] = p;
+      SA[p] = i;
+    }
+    induce(str, t, SA, m, K, bkt.data());
+    u64 m1 = 0;
+    for (u64 i = 0; i < m; i++) if (t.lms(SA[i])) SA[m1++] = SA[i];
+    // name them, equal neighbours are found by the threads
+    vector<u64> diff((m1 + 63) >> 6, 0);
+    const u64 CH = 1 << 12;
+    parallel_for((m1 + CH - 1) / CH, [&](u64 k) {
+      for (u64 i = max<u64>(1, k * CH); i < min(m1, (k + 1) * CH); i++) {
+        u64 a = SA[i - 1], b = SA[i];
+        for (u64 d = 0; ; d++) {
+          if (str[a + d] != str[b + d] || t[a + d] != t[b + d]) {
+            diff[i >> 6] |= 1ULL << (i & 63);
+            break;
+          }
+          if (d && (t.lms(a + d) || t.lms(b + d))) break;
+        }
+      }
+    });
+    for (u64 i = m1; i < m; i++) SA[i] = EMPTY;
+    u64 name = 0;
+    for (u64 i = 0; i < m1; i++) {
+      name += !i || (diff[i >> 6] >> (i & 63) & 1);
+      SA[m1 + ((u64)SA[i] >> 1)] = name - 1;
+    }
+    vector<u64>().swap(diff);
+    for (u64 i = m, j = m; i-- > m1; ) if (SA[i] != EMPTY) SA[--j] = SA[i];
+    // sort the reduced string
+    I *s1 = SA + m - m1;
+    if (name < m1) {
+      vector<I>().swap(bkt);
+      sais(Reduced{s1}, SA, m1, name);
+      bkt.resize(K);
+    } else for (u64 i = 0; i < m1; i++) SA[s1[i]] = i;
+    // induce from the sorted LMS suffixes
+    for (u64 i = 1, j = 0; i < m; i++) if (t.lms(i)) s1[j++] = i;
+    for (u64 i = 0; i < m1; i++) SA[i] = s1[SA[i]];
+    for (u64 i = m1; i < m; i++) SA[i] = EMPTY;
+    buckets(str, m, K, bkt.data(), true);
+    for (u64 i = m1; i-- > 0; ) {
+      u64 j = SA[i], p = (u64)bkt[str[j]] - 1;
+      SA[i] = EMPTY;
+      bkt[str[j]] = p;
+      SA[p] = j;
+    }
+    induce(str, t, SA, m, K, bkt.data());
+  }
+  // path = "": in memory, otherwise sa is written to that file (n indices of sizeof(I) bytes)
+  bool build(const string &path = "") {
+    assert(n + 1 < EMPTY - 1);
+    if (!sa.create(n + 1, path)) return false;
+    if (!n) return sa.shrink(0), true;
+    sais(Text{s, n}, sa.a, n + 1, 257);
+    memmove(sa.a, sa.a + 1, n * sizeof(I)); // drop the sentinel
+    sa.shrink(n);
+    return true;
+  }
+  // PLCP[i] = lcp of the suffix i and the one before it in sa (0 for sa[0])
+  bool build_plcp(const string &path = "") {
+    if (!plcp.create(n, path)) return false;
+    if (!n) return true;
+    I *phi = plcp.a;
+    const u64 CH = 1 << 16, chunks = (n + CH - 1) / CH;
+    parallel_for(chunks, [&](u64 k) {
+      for (u64 r = k * CH; r < min(n, (k + 1) * CH); r++) phi[sa[r]] = r ? (u64)sa[r - 1] : EMPTY;
+    });
+    // one contiguous range per thread, h restarts from 0 only at the start of a range
+    const u64 P = threads;
+    parallel_for(P, [&](u64 k) {
+      u64 h = 0;
+      for (u64 i = n * k / P; i < n * (k + 1) / P; i++) {
+        u64 j = phi[i];
+        if (j == EMPTY) h = 0;
+        else while (i + h < n && j + h < n && s[i + h] == s[j + h]) h++;
+        phi[i] = h;
+        if (h) h--;
+      }
+    });
+    return true;
+  }
+  // lcp in suffix array order, needs build_plcp()
+  bool build_lcp(MappedArray<I> &lcp, const string &path = "") {
+    if (!lcp.create(n, path)) return false;
+    const u64 CH = 1 << 16;
+    parallel_for((n + CH - 1) / CH, [&](u64 k) {
+      for (u64 r = k * CH; r < min(n, (k + 1) * CH); r++) lcp[r] = plcp[sa[r]];
+    });
+    return true;
+  }
+  // keeps PLCP[i] only for i % _q == 0
+  void build_sparse_plcp(int _q) {
+    q = _q;
+    u64 k = (n + q - 1) / q;
+    sp.assign(k, 0);
+    if (!n) return;
+    const u64 CH = 1 << 16;
+    parallel_for((n + CH - 1) / CH, [&](u64 c) {
+      for (u64 r = c * CH; r < min(n, (c + 1) * CH); r++) if (sa[r] % q == 0) sp[sa[r] / q] = r ? (u64)sa[r - 1] : EMPTY;
+    });
+    const u64 P = threads;
+    parallel_for(P, [&](u64 c) {
+      u64 h = 0;
+      for (u64 x = k * c / P; x < k * (c + 1) / P; x++) {
+        u64 i = x * q, j = sp[x];
+        if (j == EMPTY) h = 0;
+        else while (i + h < n && j + h < n && s[i + h] == s[j + h]) h++;
+        sp[x] = h;
+        h = h > (u64)q ? h - q : 0;
+      }
+    });
+  }
+  // lcp(sa[r - 1], sa[r]) from the sparse PLCP
+  u64 lcp(u64 r) const {
+    if (!r) return 0;
+    u64 i = sa[r], j = sa[r - 1], x = i / q, h = sp[x];
+    h = h > i - x * q ? h - (i - x * q) : 0;
+    while (i + h < n && j + h < n && s[i + h] == s[j + h]) h++;
+    return h;
+  }
+  // [l, r) of the suffixes starting with p
+  pair<u64, u64> range(const char *p, u64 m) const {
+    auto cmp = [&](u64 i) { // sign of suffix i (cut to m) - p
+      u64 k = min(m, n - i);
+      int c = memcmp(s + i, p, k);
+      return c ? c : k < m ? -1 : 0;
+    };
+    u64 lo = 0, hi = n;
+    while (lo < hi) {
+      u64 mid = (lo + hi) / 2;
+      if (cmp(sa[mid]) < 0) lo = mid + 1;
+      else hi = mid;
+    }
+    u64 l = lo;
+    hi = n;
+    while (lo < hi) {
+      u64 mid = (lo + hi) / 2;
+      if (cmp(sa[mid]) <= 0) lo = mid + 1;
+      else hi = mid;
+    }
+    return {l, lo};
+  }
+};
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  string s;
+  cin >> s;
+  SuffixArrayLarge<uint32_t> S((const unsigned char *)s.data(), s.size(), thread::hardware_concurrency());
+  S.build();
+  for (u64 i = 0; i < s.size(); i++) cout << S.sa[i] << " \n"[i + 1 == s.size()];
+  return 0;
+}
+// https://judge.yosupo.jp/problem/suffixarray
@@ -0,0 +1,211 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/*
+Suffix automaton without a map per state, for streams of ~1e8 letters
+K > 0: letters in [0, K), every state has a row of K ints in one pool (DNA, lowercase, ...)
+K = 0: letters are bytes, the transitions of a state are a sorted array of (to, letter) in one shared pool,
+kept as two parallel arrays (4 + 1 bytes per slot, a struct would be padded to 8),
+the array has a capacity of 2^k and is moved to a slot twice as big when it is full, the old slot goes to a
+free list of its size and is reused by the next array of that size, a clone takes a slot of the same size
+and copies it, lookup is a linear scan of the letters for up to 8 of them and a binary search above
+All the state fields are separate arrays (len, link, ...), a state is 12 bytes (+ 7 for K = 0) + its transitions
+(5 bytes per pool slot for K = 0), 2e7 random lowercase letters with K = 0: 27M states, 61M pool slots for
+47M transitions, ~60 bytes per letter without reserve()
+Generalized: add_string() / feed() starting with reset() per string, when the letter already leaves `last`
+the state is reused (or split) instead of creating an empty one, so nothing is duplicated
+occ0[v] = number of prefixes (of all the strings) that end in v, occurrences() pushes them up the links in
+decreasing len order, the order comes from a counting sort on len (no recursion, no adjacency lists)
+memory_usage() / report(): bytes held by the arrays (capacities, not sizes) and the slack of the pool
+Complexity: O(n) states and transitions, O(n log sigma) time (O(n) for K > 0)
+0-indexed, state 0 is the root, link[0] = -1
+*/
+template<int K = 0>
+struct SuffixAutomatonCompact {
+  int sz, last, maxlen;
+  vector<int> len, link, occ0;
+  // K > 0
+  vector<int> row;
+  // K = 0
+  vector<int> off;
+  vector<uint16_t> deg;
+  vector<unsigned char> cls;
+  vector<int> pto; // pool: target of the slot, next free slot for a free one
+  vector<unsigned char> plab; // pool: letter of the slot
+  int fre[9];
+  long long edges, letters;
+  SuffixAutomatonCompact() {
+    sz = 0, maxlen = 0, edges = 0, letters = 0;
+    fill(fre, fre + 9, -1);
+    last = new_state(0);
+    link[0] = -1;
+  }
+  // for a text of about n letters
+  void reserve(long long n) {
+    len.reserve(2 * n), link.reserve(2 * n), occ0.reserve(2 * n);
+    if (K) row.reserve(2 * n * K);
+    else off.reserve(2 * n), deg.reserve(2 * n), cls.reserve(2 * n), pto.reserve(3 * n), plab.reserve(3 * n);
+  }
+  int new_state(int l) {
+    len.push_back(l), link.push_back(0), occ0.push_back(0);
+    if (K) row.resize(row.size() + K, -1);
+    else off.push_back(-1), deg.push_back(0), cls.push_back(0);
+    maxlen = max(maxlen, l);
+    return sz++;
+  }
+  int alloc(int k) {
+    int s = fre[k];
+    if (s != -1) fre[k] = pto[s];
+    else s = pto.size(), pto.resize(s + (1 << k)), plab.resize(s + (1 << k));
+    return s;
+  }
+  void release(int s, int k) {
+    pto[s] = fre[k];
+    fre[k] = s;
+  }
+  inline int get(int v, int c) const {
+    if constexpr (K > 0) return row[(long long)v * K + c];
+    int d = deg[v];
+    if (!d) return -1;
+    const unsigned char *e = plab.data() + off[v];
+    if (d <= 8) {
+      for (int i = 0; i < d; i++) if (e[i] == c) return pto[off[v] + i];
+      return -1;
+    }
+    int lo = 0, hi = d;
+    while (lo < hi) {
+      int mid = (lo + hi) >> 1;
+      if (e[mid] < c) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo < d && e[lo] == c ? pto[off[v] + lo] : -1;
+  }
+  void set(int v, int c, int to) {
+    if constexpr (K > 0) {
+      int &x = row[(long long)v * K + c];
+      edges += x == -1;
+      x = to;
+      return;
+    }
+    int d = deg[v], i = 0;
+    while (i < d && plab[off[v] + i] < c) i++;
+    if (i < d && plab[off[v] + i] == c) {
+      pto[off[v] + i] = to;
+      return;
+    }
+    if (off[v] == -1) off[v] = alloc(0);
+    else if (d == 1 << cls[v]) {
+      int s = alloc(cls[v] + 1);
+      copy(pto.begin() + off[v], pto.begin() + off[v] + d, pto.begin() + s);
+      copy(plab.begin() + off[v], plab.begin() + off[v] + d, plab.begin() + s);
+      release(off[v], cls[v]);
+      off[v] = s, cls[v]++;
+    }
+    int o = off[v];
+    for (int j = d; j > i; j--) pto[o + j] = pto[o + j - 1], plab[o + j] = plab[o + j - 1];
+    pto[o + i] = to, plab[o + i] = c;
+    deg[v]++;
+    edges++;
+  }
+  // copy of q with length l, q hangs below it
+  int clone(int q, int l) {
+    int w = new_state(l);
+    link[w] = link[q];
+    link[q] = w;
+    if (K) copy(row.begin() + (long long)q * K, row.begin() + (long long)(q + 1) * K, row.begin() + (long long)w * K);
+    else if (deg[q]) {
+      off[w] = alloc(cls[q]), cls[w] = cls[q], deg[w] = deg[q];
+      copy(pto.begin() + off[q], pto.begin() + off[q] + deg[q], pto.begin() + off[w]);
+      copy(plab.begin() + off[q], plab.begin() + off[q] + deg[q], plab.begin() + off[w]);
+    }
+    if (K) for (int c = 0; c < K; c++) edges += row[(long long)w * K + c] != -1;
+    else edges += deg[w];
+    return w;
+  }
+  void extend(int c) {
+    letters++;
+    int p = last, q = get(p, c);
+    if (q != -1) { // only in the generalized build
+      if (len[q] == len[p] + 1) last = q;
+      else {
+        int w = clone(q, len[p] + 1);
+        for (; p != -1 && get(p, c) == q; p = link[p]) set(p, c, w);
+        last = w;
+      }
+      occ0[last]++;
+      return;
+    }
+    int cur = new_state(len[last] + 1);
+    for (; p != -1 && get(p, c) == -1; p = link[p]) set(p, c, cur);
+    if (p == -1) link[cur] = 0;
+    else {
+      q = get(p, c);
+      if (len[p] + 1 == len[q]) link[cur] = q;
+      else {
+        int w = clone(q, len[p] + 1);
+        for (; p != -1 && get(p, c) == q; p = link[p]) set(p, c, w);
+        link[cur] = w;
+      }
+    }
+    last = cur;
+    occ0[cur]++;
+  }
+  // the next letters start a new string
+  void reset() {
+    last = 0;
+  }
+  // appends a chunk to the current string, letter = byte - base
+  void feed(const char *s, size_t n, int base = 0) {
+    for (size_t i = 0; i < n; i++) extend((unsigned char)s[i] - base);
+  }
+  void add_string(const string &s, int base = 0) {
+    reset();
+    feed(s.data(), s.size(), base);
+  }
+  // states by increasing len
+  vector<int> order() const {
+    vector<int> c(maxlen + 2, 0), ord(sz);
+    for (int v = 0; v < sz; v++) c[len[v] + 1]++;
+    for (int i = 0; i <= maxlen; i++) c[i + 1] += c[i];
+    for (int v = 0; v < sz; v++) ord[c[len[v]]++] = v;
+    return ord;
+  }
+  // number of occurrences of the strings of every state (summed over the strings)
+  vector<long long> occurrences() const {
+    vector<long long> oc(occ0.begin(), occ0.end());
+    vector<int> ord = order();
+    for (int i = sz - 1; i > 0; i--) oc[link[ord[i]]] += oc[ord[i]];
+    return oc;
+  }
+  long long distinct_substrings() const {
+    long long ans = 0;
+    for (int v = 1; v < sz; v++) ans += len[v] - len[link[v]];
+    return ans;
+  }
+  template<typename T>
+  static size_t bytes(const vector<T> &a) {
+    return a.capacity() * sizeof(T);
+  }
+  size_t memory_usage() const {
+    return bytes(len) + bytes(link) + bytes(occ0) + bytes(row) + bytes(off) + bytes(deg) + bytes(cls) + bytes(pto) + bytes(plab);
+  }
+  void report(ostream &os) const {
+    os << "states " << sz << ", transitions " << edges;
+    if (!K) os << ", pool " << pto.size() << " slots (" << pto.size() - edges << " unused)";
+    os << ", " << memory_usage() / 1048576.0 << " MB, " << (double)memory_usage() / max(1LL, letters) << " bytes per letter\n";
+  }
+};
+
+int32_t main() {
+  ios_base::sync_with_stdio(0);
+  cin.tie(0);
+  int t; cin >> t;
+  while (t--) {
+    string s; cin >> s;
+    SuffixAutomatonCompact<26> sa;
+    sa.reserve(s.size());
+    sa.add_string(s, 'a');
+    cout << sa.distinct_substrings() << '\n'; // number of unique substrings
+  }
+  return 0;
+}